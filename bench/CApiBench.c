@@ -0,0 +1,76 @@
+/* Embedding cost: load an in-memory workload through the C ABI, run it and
+ * read the summary, many times in one process (what a capacity planner
+ * would otherwise do by spawning the executable per configuration).
+ *
+ * Usage: CApiBench [runs=2000] [processes=50] */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "capi/ps_sim.h"
+
+static double now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    int runs = (argc > 1) ? atoi(argv[1]) : 2000;
+    int M = (argc > 2) ? atoi(argv[2]) : 50;
+
+    ps_process *procs = (ps_process *)calloc((size_t)M, sizeof(ps_process));
+    ps_io *ios = (ps_io *)calloc((size_t)M, sizeof(ps_io));
+    srand(12345);
+    for (int i = 0; i < M; ++i)
+    {
+        procs[i].at = rand() % (M / 2 + 1);
+        procs[i].pid = i + 1;
+        procs[i].ct = 1 + rand() % 30;
+        procs[i].dl = procs[i].at + procs[i].ct + rand() % 60;
+        if (procs[i].ct > 2)
+        {
+            ios[i].request = 1 + rand() % (procs[i].ct - 1);
+            ios[i].duration = 1 + rand() % 10;
+            procs[i].io_count = 1;
+            procs[i].io = &ios[i];
+        }
+    }
+
+    ps_sim *sim = ps_create();
+    double checksum = 0;
+    double t0 = now();
+    for (int r = 0; r < runs; ++r)
+    {
+        ps_config cfg = {0};
+        cfg.size = sizeof cfg;
+        cfg.nf = 1 + r % 3;
+        cfg.ns = 1;
+        cfg.nr = 1;
+        cfg.ne = 1;
+        cfg.time_slice = 4;
+        cfg.rtf = 5;
+        cfg.max_w = 20;
+        cfg.fork_prob = 10;
+        cfg.fork_seed = 1;
+
+        ps_summary sum = {0};
+        sum.size = sizeof sum;
+        if (ps_load(sim, &cfg, procs, M, NULL, 0) != 0 || ps_run(sim) != 0 ||
+            ps_summary_get(sim, &sum) != 0)
+        {
+            printf("run %d failed: %s\n", r, ps_last_error(sim));
+            return 1;
+        }
+        checksum += sum.avg_trt;
+    }
+    double sec = now() - t0;
+    ps_destroy(sim);
+    free(procs);
+    free(ios);
+
+    printf("abi=%d runs=%d processes=%d per-run=%.1f us (checksum %.3f)\n",
+           ps_abi_version(), runs, M, sec * 1e6 / runs, checksum);
+    return 0;
+}
@@ -0,0 +1,108 @@
+// Observer hook cost: the same in-memory workload run by the default
+// Scheduler (NullObserver) and by a scheduler whose observer counts every
+// event. The unobserved time should match SimBench on the same workload.
+//
+// Usage: ObserverBench [processors=1000] [processes=20000] [repeats=3]
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "core/SchedulerImpl.h"
+
+struct CountingObserver : NullObserver
+{
+    long long events[11] = {};
+
+    void onArrival(const Process *, int, long long) { ++events[0]; }
+    void onDispatch(const Process *, int, long long) { ++events[1]; }
+    void onPreempt(const Process *, int, long long) { ++events[2]; }
+    void onBlock(const Process *, int, long long) { ++events[3]; }
+    void onIOStart(const Process *, int, long long) { ++events[4]; }
+    void onIOFinish(const Process *, long long) { ++events[5]; }
+    void onMigrate(const Process *, int, int, long long) { ++events[6]; }
+    void onSteal(const Process *, int, int, long long) { ++events[7]; }
+    void onFork(const Process *, const Process *, long long) { ++events[8]; }
+    void onKill(const Process *, TermReason, long long) { ++events[9]; }
+    void onTerminate(const Process *, TermReason, long long) { ++events[10]; }
+};
+
+static void makeWorkload(int procs, int M, SimConfig &cfg, std::vector<ProcessSpec> &ps)
+{
+    int q = procs / 4;
+    cfg.NF = cfg.NS = cfg.NR = q;
+    cfg.NE = procs - 3 * q;
+    cfg.timeSlice = 4;
+    cfg.RTF = 5;
+    cfg.MaxW = 20;
+    cfg.STL = 0; // keep stealing out of the measured loop, like SimBench
+
+    std::srand(12345);
+    ps.resize((std::size_t)M);
+    for (int i = 0; i < M; ++i)
+    {
+        ProcessSpec &p = ps[(std::size_t)i];
+        p.PID = i + 1;
+        p.AT = std::rand() % (M / 2 + 1);
+        p.CT = 1 + std::rand() % 60;
+        p.DL = p.AT + p.CT + std::rand() % 120;
+        int ios = (p.CT > 2) ? std::rand() % 3 : 0;
+        int r = 0;
+        for (int k = 0; k < ios; ++k)
+        {
+            r += 1 + std::rand() % ((p.CT - 1) / ios);
+            p.io.push_back(IORequest{r, 1 + std::rand() % 15});
+        }
+    }
+}
+
+template <typename Obs>
+static double bestOf(int repeats, const SimConfig &cfg, const std::vector<ProcessSpec> &ps,
+                     Obs *last = nullptr)
+{
+    double best = 0.0;
+    for (int r = 0; r < repeats; ++r)
+    {
+        BasicScheduler<Obs> s;
+        std::string err;
+        if (!s.load(cfg, ps.data(), (int)ps.size(), nullptr, 0, err))
+        {
+            std::cout << "Load failed: " << err << "\n";
+            std::exit(1);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        s.run(UIMode::Silent);
+        auto t1 = std::chrono::steady_clock::now();
+
+        double sec = std::chrono::duration<double>(t1 - t0).count();
+        if (r == 0 || sec < best)
+            best = sec;
+        if (last)
+            *last = s.observer();
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    int procs = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    int M = (argc > 2) ? std::atoi(argv[2]) : 20000;
+    int repeats = (argc > 3) ? std::atoi(argv[3]) : 3;
+
+    SimConfig cfg;
+    std::vector<ProcessSpec> ps;
+    makeWorkload(procs, M, cfg, ps);
+
+    double none = bestOf<NullObserver>(repeats, cfg, ps);
+    CountingObserver counts;
+    double counted = bestOf<CountingObserver>(repeats, cfg, ps, &counts);
+
+    const char *names[11] = {"arrival", "dispatch", "preempt", "block", "io-start", "io-finish",
+                             "migrate", "steal", "fork", "kill", "terminate"};
+    std::cout << "processors=" << procs << " processes=" << M << "\n";
+    std::cout << "null observer:     best=" << none * 1000.0 << " ms\n";
+    std::cout << "counting observer: best=" << counted * 1000.0 << " ms\n";
+    for (int i = 0; i < 11; ++i)
+        std::cout << "  " << names[i] << "=" << counts.events[i] << "\n";
+    return 0;
+}
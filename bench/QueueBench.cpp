@@ -0,0 +1,117 @@
+// Ready-queue benchmark: binary MinHeap (comparator through pointers, as in
+// SJF/EDF) vs RadixHeap on packed (key, PID) values, for 10^3..10^6 entries.
+//
+//   hold:  n queued; repeat pop-min, push (popped key + random increment)
+//   drain: push n random keys, then pop them all
+//
+// Usage: QueueBench [maxN=1000000]
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include "ds/MinHeap.h"
+#include "ds/RadixHeap.h"
+
+struct Item
+{
+    int key;
+    int pid;
+};
+
+static bool lessItem(Item *const &a, Item *const &b)
+{
+    if (a->key != b->key)
+        return a->key < b->key;
+    return a->pid < b->pid;
+}
+
+static std::uint64_t packed(const Item *it)
+{
+    return ((std::uint64_t)(std::uint32_t)it->key << 32) | (std::uint32_t)it->pid;
+}
+
+static unsigned rnd(unsigned &s)
+{
+    s = s * 1103515245u + 12345u;
+    return s >> 8;
+}
+
+template <typename PushF, typename PopF>
+static double runHold(Item *items, int n, long long ops, PushF push, PopF pop)
+{
+    unsigned s = 42;
+    for (int i = 0; i < n; ++i)
+    {
+        items[i].key = (int)(rnd(s) % (unsigned)(4 * n));
+        items[i].pid = i;
+        push(&items[i]);
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    long long sink = 0;
+    for (long long k = 0; k < ops; ++k)
+    {
+        Item *it = pop();
+        sink += it->pid;
+        it->key += 1 + (int)(rnd(s) % (unsigned)(4 * n));
+        push(it);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i)
+        pop();
+    if (sink == -1)
+        std::printf("!");
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+template <typename PushF, typename PopF>
+static double runDrain(Item *items, int n, PushF push, PopF pop)
+{
+    unsigned s = 7;
+    for (int i = 0; i < n; ++i)
+    {
+        items[i].key = (int)(rnd(s) % 1000000000u);
+        items[i].pid = i;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i)
+        push(&items[i]);
+    long long sink = 0;
+    for (int i = 0; i < n; ++i)
+        sink += pop()->pid;
+    auto t1 = std::chrono::steady_clock::now();
+    if (sink == -1)
+        std::printf("!");
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main(int argc, char **argv)
+{
+    int maxN = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    std::printf("%-6s %9s %12s %12s %8s\n", "work", "n", "heap ms", "radix ms", "speedup");
+    for (int n = 1000; n <= maxN; n *= 10)
+    {
+        Item *items = new Item[n];
+        long long ops = 4000000;
+
+        for (int w = 0; w < 2; ++w)
+        {
+            double th, tr;
+            {
+                MinHeap<Item *> h(&lessItem);
+                auto push = [&](Item *it) { h.push(it); };
+                auto pop = [&]() { return h.pop(); };
+                th = w == 0 ? runHold(items, n, ops, push, pop) : runDrain(items, n, push, pop);
+            }
+            {
+                RadixHeap<Item *> r;
+                auto push = [&](Item *it) { r.push(packed(it), it); };
+                auto pop = [&]() { return r.pop(); };
+                tr = w == 0 ? runHold(items, n, ops, push, pop) : runDrain(items, n, push, pop);
+            }
+            std::printf("%-6s %9d %12.2f %12.2f %7.2fx\n", w == 0 ? "hold" : "drain", n, th, tr, th / tr);
+        }
+        delete[] items;
+    }
+    return 0;
+}
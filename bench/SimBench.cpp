@@ -0,0 +1,73 @@
+// Throughput benchmark: synthesizes a workload for a large processor mix,
+// runs it in silent mode and reports simulated ticks per second.
+//
+// Usage: SimBench [processors=1000] [processes=20000] [repeats=3]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "core/Scheduler.h"
+
+static void writeWorkload(const std::string &path, int procs, int M)
+{
+    std::ofstream out(path);
+    int q = procs / 4;
+    out << q << " " << q << " " << q << " " << (procs - 3 * q) << "\n";
+    out << "4\n";
+    out << "5 20 0 5\n"; // STL=0: keep stealing out of the measured loop
+    out << M << "\n";
+
+    std::srand(12345);
+    for (int pid = 1; pid <= M; ++pid)
+    {
+        int at = std::rand() % (M / 2 + 1);
+        int ct = 1 + std::rand() % 60;
+        int dl = at + ct + std::rand() % 120;
+        int ios = (ct > 2) ? std::rand() % 3 : 0;
+        out << at << " " << pid << " " << ct << " " << dl << " " << ios;
+        int r = 0;
+        for (int k = 0; k < ios; ++k)
+        {
+            r += 1 + std::rand() % ((ct - 1) / ios);
+            out << " (" << r << "," << (1 + std::rand() % 15) << ")";
+        }
+        out << "\n";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int procs = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    int M = (argc > 2) ? std::atoi(argv[2]) : 20000;
+    int repeats = (argc > 3) ? std::atoi(argv[3]) : 3;
+
+    const std::string path = "simbench_input.txt";
+    writeWorkload(path, procs, M);
+
+    double best = 0.0;
+    for (int r = 0; r < repeats; ++r)
+    {
+        Scheduler s;
+        std::string err;
+        if (!s.load(path, err))
+        {
+            std::cout << "Load failed: " << err << "\n";
+            return 1;
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        s.simulate(UIMode::Silent);
+        auto t1 = std::chrono::steady_clock::now();
+
+        double sec = std::chrono::duration<double>(t1 - t0).count();
+        if (r == 0 || sec < best)
+            best = sec;
+    }
+
+    std::remove(path.c_str());
+    std::cout << "processors=" << procs << " processes=" << M
+              << " kernel=" << tickKernelName() << " best=" << best * 1000.0 << " ms\n";
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include "capi/ps_sim.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/Scheduler.h"
+
+struct ps_sim
+{
+    std::unique_ptr<Scheduler> s;
+    bool ran = false;
+    std::string err;
+};
+
+static int fail(ps_sim *sim, const std::string &what)
+{
+    sim->err = what;
+    return -1;
+}
+
+// fresh Scheduler per load: reloading an existing one is not supported
+static Scheduler &reset(ps_sim *sim, bool firm, bool binaryHeap, unsigned forkSeed)
+{
+    sim->s.reset(new Scheduler());
+    sim->ran = false;
+    sim->err.clear();
+    sim->s->setDeadlinePolicy(firm ? DeadlinePolicy::Firm : DeadlinePolicy::Soft);
+    sim->s->setReadyQueueKind(binaryHeap ? ReadyQueueKind::BinaryHeap : ReadyQueueKind::Radix);
+    if (forkSeed != 0)
+        sim->s->seedForkRng(forkSeed);
+    return *sim->s;
+}
+
+extern "C"
+{
+
+int ps_abi_version(void) { return PS_ABI_VERSION; }
+
+ps_sim *ps_create(void) { return new ps_sim(); }
+
+void ps_destroy(ps_sim *sim) { delete sim; }
+
+int ps_load(ps_sim *sim, const ps_config *userCfg,
+            const ps_process *procs, int n,
+            const ps_kill *kills, int nk)
+{
+    if (!sim)
+        return -1;
+    if (!userCfg || userCfg->size < sizeof(unsigned) || (n > 0 && !procs) || (nk > 0 && !kills))
+        return fail(sim, "bad arguments");
+
+    // fields a smaller (older) struct lacks stay zero
+    ps_config local;
+    std::memset(&local, 0, sizeof local);
+    std::memcpy(&local, userCfg, std::min<std::size_t>(userCfg->size, sizeof local));
+    const ps_config *cfg = &local;
+
+    SimConfig c;
+    c.NF = cfg->nf;
+    c.NS = cfg->ns;
+    c.NR = cfg->nr;
+    c.NE = cfg->ne;
+    c.NM = cfg->nm;
+    c.NC = cfg->nc;
+    c.NL = cfg->nl;
+    c.timeSlice = cfg->time_slice;
+    c.mlfqLevels = cfg->mlfq_levels;
+    c.mlfqBoost = cfg->mlfq_boost;
+    if (cfg->nm > 0 && cfg->mlfq_quanta && cfg->mlfq_levels > 0)
+        c.mlfqQuanta.assign(cfg->mlfq_quanta, cfg->mlfq_quanta + cfg->mlfq_levels);
+    c.cfsLatency = cfg->cfs_latency;
+    c.cfsMinGran = cfg->cfs_min_gran;
+    c.llfHysteresis = cfg->llf_hysteresis;
+
+    int total = cfg->nf + cfg->ns + cfg->nr + cfg->ne + cfg->nm + cfg->nc + cfg->nl;
+    if (cfg->speeds && total > 0)
+        for (int i = 0; i < total; ++i)
+            c.speeds.push_back((int)std::lround(cfg->speeds[i] * SPEED_ONE));
+
+    c.powerEnabled = cfg->power_enabled != 0;
+    if (c.powerEnabled)
+    {
+        if (!cfg->power_busy || !cfg->power_idle || !cfg->power_sleep)
+            return fail(sim, "power model needs busy/idle/sleep arrays");
+        c.idleThreshold = cfg->idle_threshold;
+        c.wakeLatency = cfg->wake_latency;
+        c.powerBusy.assign(cfg->power_busy, cfg->power_busy + PROC_TYPE_COUNT);
+        c.powerIdle.assign(cfg->power_idle, cfg->power_idle + PROC_TYPE_COUNT);
+        c.powerSleep.assign(cfg->power_sleep, cfg->power_sleep + PROC_TYPE_COUNT);
+    }
+    c.RTF = cfg->rtf;
+    c.MaxW = cfg->max_w;
+    c.STL = cfg->stl;
+    c.forkProb = cfg->fork_prob;
+
+    std::vector<ProcessSpec> ps((std::size_t)(n > 0 ? n : 0));
+    for (int i = 0; i < n; ++i)
+    {
+        ps[i].AT = procs[i].at;
+        ps[i].PID = procs[i].pid;
+        ps[i].CT = procs[i].ct;
+        ps[i].DL = procs[i].dl;
+        ps[i].weight = procs[i].weight == 0 ? 1 : procs[i].weight;
+        if (procs[i].io_count > 0 && !procs[i].io)
+            return fail(sim, "io_count > 0 without io array");
+        for (int k = 0; k < procs[i].io_count; ++k)
+            ps[i].io.push_back(IORequest{procs[i].io[k].request, procs[i].io[k].duration});
+    }
+    std::vector<KillEvent> ks((std::size_t)(nk > 0 ? nk : 0));
+    for (int i = 0; i < nk; ++i)
+        ks[i] = KillEvent{kills[i].time, kills[i].pid};
+
+    Scheduler &s = reset(sim, cfg->firm_deadlines != 0, cfg->binary_heap_rdy != 0, cfg->fork_seed);
+    s.setHorizon(cfg->horizon);
+    std::string err;
+    if (!s.load(c, ps.data(), n, ks.data(), nk, err))
+    {
+        sim->s.reset();
+        return fail(sim, err);
+    }
+    return 0;
+}
+
+int ps_load_file(ps_sim *sim, const char *path,
+                 int firm_deadlines, int binary_heap_rdy, unsigned fork_seed)
+{
+    if (!sim)
+        return -1;
+    if (!path)
+        return fail(sim, "bad arguments");
+    Scheduler &s = reset(sim, firm_deadlines != 0, binary_heap_rdy != 0, fork_seed);
+    std::string err;
+    if (!s.load(path, err))
+    {
+        sim->s.reset();
+        return fail(sim, err);
+    }
+    return 0;
+}
+
+int ps_run(ps_sim *sim)
+{
+    if (!sim)
+        return -1;
+    if (!sim->s)
+        return fail(sim, "nothing loaded");
+    if (sim->ran)
+        return fail(sim, "already ran; load again first");
+    sim->s->run(UIMode::Silent);
+    sim->ran = true;
+    return 0;
+}
+
+int ps_summary_get(const ps_sim *sim, ps_summary *out)
+{
+    if (!sim || !out || out->size < sizeof(unsigned) || !sim->ran)
+        return -1;
+
+    RunTotals r = sim->s->totals();
+    ps_summary full;
+    std::memset(&full, 0, sizeof full);
+    full.size = out->size;
+    full.processes = r.count;
+    full.forked = r.forked;
+    full.killed = r.killed;
+    full.migrations_rtf = r.migRTF;
+    full.migrations_maxw = r.migMaxW;
+    full.steal_moves = r.steals;
+    full.deadline_aborts = r.aborted;
+    full.deadline_completed = r.dlDone;
+    full.deadline_met = r.dlMet;
+    if (r.count > 0)
+    {
+        full.avg_wt = (double)r.sumWT / r.count;
+        full.avg_rt = (double)r.sumRT / r.count;
+        full.avg_trt = (double)r.sumTRT / r.count;
+    }
+    full.ticks = r.ticks;
+    full.busy = r.busy;
+    full.idle = r.idle;
+    full.unterminated = r.unterminated;
+    // a smaller (older) struct only gets the fields it knows
+    std::memcpy(out, &full, std::min<std::size_t>(out->size, sizeof full));
+    return 0;
+}
+
+int ps_write_report(const ps_sim *sim, const char *path)
+{
+    if (!sim || !path || !sim->ran)
+        return -1;
+    sim->s->writeOutputFile(path);
+    return 0;
+}
+
+const char *ps_last_error(const ps_sim *sim)
+{
+    return sim ? sim->err.c_str() : "null handle";
+}
+
+}
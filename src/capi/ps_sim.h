@@ -0,0 +1,133 @@
+/* C interface to the simulator, for embedding it without spawning the
+ * executable. All functions are thread-compatible: one ps_sim handle must
+ * not be used from two threads at once, distinct handles are independent.
+ *
+ * A caller fills a ps_config (zero-initialize it, then set what it needs),
+ * passes the workload as arrays, runs, and reads a ps_summary. Structs are
+ * only ever extended at the end; size fields let older callers keep
+ * working against newer libraries. */
+#ifndef PS_SIM_H
+#define PS_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#if defined(PS_SIM_BUILD)
+#define PS_API __declspec(dllexport)
+#else
+#define PS_API __declspec(dllimport)
+#endif
+#else
+#define PS_API __attribute__((visibility("default")))
+#endif
+
+#define PS_ABI_VERSION 1
+
+typedef struct ps_sim ps_sim;
+
+typedef struct ps_config
+{
+    unsigned size; /* sizeof(ps_config) */
+
+    /* processor counts, in the input file's order */
+    int nf, ns, nr, ne, nm, nc, nl;
+    int time_slice;
+
+    int mlfq_levels;
+    int mlfq_boost;
+    const int *mlfq_quanta; /* mlfq_levels entries (when nm > 0) */
+
+    int cfs_latency;
+    int cfs_min_gran;
+
+    int llf_hysteresis;
+
+    const double *speeds; /* one per processor in global order, or NULL for all 1.0 */
+
+    int power_enabled;
+    int idle_threshold;
+    int wake_latency;
+    const double *power_busy;  /* 7 entries, FCFS..LLF (when power_enabled) */
+    const double *power_idle;
+    const double *power_sleep;
+
+    int rtf, max_w, stl, fork_prob;
+
+    int firm_deadlines;   /* deadline policy: 0 soft, 1 firm */
+    int binary_heap_rdy;  /* SJF/EDF ready queue: 0 radix heap, 1 binary heap */
+    /* fork decisions: 0 draws from the process-wide std::rand stream like the
+     * executable (so results depend on earlier runs in the same process);
+     * anything else seeds a generator owned by this handle, reproducible */
+    unsigned fork_seed;
+    long long horizon; /* ps_run stops before this tick; 0 runs to completion */
+} ps_config;
+
+typedef struct ps_io
+{
+    int request;  /* CPU time executed when the IO is issued */
+    int duration;
+} ps_io;
+
+typedef struct ps_process
+{
+    long long at;
+    int pid, ct;
+    long long dl; /* absolute, -1: no deadline */
+    int weight;   /* 0 means 1 */
+    int io_count;
+    const ps_io *io;
+} ps_process;
+
+typedef struct ps_kill
+{
+    long long time;
+    int pid;
+} ps_kill;
+
+typedef struct ps_summary
+{
+    unsigned size; /* set by the caller to sizeof(ps_summary) */
+
+    int processes; /* terminated, forked children included */
+    int forked;
+    int killed;
+    int migrations_rtf;
+    int migrations_maxw;
+    int steal_moves;
+    int deadline_aborts;
+    int deadline_completed; /* completed processes with a deadline */
+    int deadline_met;
+    double avg_wt, avg_rt, avg_trt;
+    long long ticks;
+    long long busy, idle; /* summed over processors */
+    int unterminated;     /* processes left when the horizon stopped the run */
+} ps_summary;
+
+PS_API int ps_abi_version(void);
+
+PS_API ps_sim *ps_create(void);
+PS_API void ps_destroy(ps_sim *sim);
+
+/* 0 on success; on failure ps_last_error() says why. Loading again
+ * discards the previous workload and results. */
+PS_API int ps_load(ps_sim *sim, const ps_config *cfg,
+                   const ps_process *procs, int n,
+                   const ps_kill *kills, int nk);
+PS_API int ps_load_file(ps_sim *sim, const char *path,
+                        int firm_deadlines, int binary_heap_rdy, unsigned fork_seed);
+
+/* silent run to completion; no files are written */
+PS_API int ps_run(ps_sim *sim);
+PS_API int ps_summary_get(const ps_sim *sim, ps_summary *out);
+/* the regular output report, e.g. for debugging one configuration */
+PS_API int ps_write_report(const ps_sim *sim, const char *path);
+
+PS_API const char *ps_last_error(const ps_sim *sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
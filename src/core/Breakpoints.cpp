@@ -0,0 +1,103 @@
+#include "core/Breakpoints.h"
+#include <cstdlib>
+#include <sstream>
+
+static bool parseNonNegative(const std::string &s, int &out)
+{
+    if (s.empty())
+        return false;
+    char *end = nullptr;
+    long v = std::strtol(s.c_str(), &end, 10);
+    if (*end != '\0' || v < 0 || v > 2147483647L)
+        return false;
+    out = (int)v;
+    return true;
+}
+
+static bool parseNonNegative(const std::string &s, long long &out)
+{
+    if (s.empty())
+        return false;
+    char *end = nullptr;
+    long long v = std::strtoll(s.c_str(), &end, 10);
+    if (*end != '\0' || v < 0)
+        return false;
+    out = v;
+    return true;
+}
+
+bool Breakpoints::parseArg(const std::string &arg, std::string &err)
+{
+    std::size_t eq = arg.find('=');
+    std::string key = arg.substr(0, eq);
+    std::string val = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+    if (key == "--break-at")
+    {
+        if (!parseNonNegative(val, at))
+        {
+            err = "--break-at expects a tick";
+            return false;
+        }
+        return true;
+    }
+
+    if (key == "--break-state")
+    {
+        std::size_t colon = val.find(':');
+        if (colon == std::string::npos || !parseNonNegative(val.substr(0, colon), pid))
+        {
+            err = "--break-state expects PID:STATE";
+            return false;
+        }
+        std::string name = val.substr(colon + 1);
+        const ProcState states[] = {ProcState::NEW, ProcState::RDY, ProcState::RUN,
+                                    ProcState::BLK, ProcState::TRM};
+        for (ProcState s : states)
+        {
+            if (name == Process::stateName(s))
+            {
+                state = s;
+                return true;
+            }
+        }
+        err = "--break-state: unknown state '" + name + "'";
+        return false;
+    }
+
+    if (key == "--break-rdy")
+    {
+        if (!parseNonNegative(val, rdyOver))
+        {
+            err = "--break-rdy expects a count";
+            return false;
+        }
+        return true;
+    }
+
+    if (key == "--break-on")
+    {
+        std::stringstream ss(val);
+        std::string ev;
+        while (std::getline(ss, ev, ','))
+        {
+            if (ev == "kill")
+                onKill = true;
+            else if (ev == "migrate")
+                onMigrate = true;
+            else if (ev == "steal")
+                onSteal = true;
+            else if (ev == "fork")
+                onFork = true;
+            else
+            {
+                err = "--break-on: unknown event '" + ev + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    err = "unknown option " + arg;
+    return false;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <string>
+#include "model/Process.h"
+
+// Conditions that stop a fast-forwarded interactive/step run. Until one
+// fires the Scheduler runs without snapshots or waiting; all of them are
+// checked after a tick completes.
+struct Breakpoints
+{
+    long long at = -1; // tick
+
+    int pid = -1; // this PID enters `state`
+    ProcState state = ProcState::RUN;
+
+    int rdyOver = -1; // some processor's RDY count goes above this
+
+    // scheduling events during the tick
+    bool onKill = false; // SIGKILL or orphan kill
+    bool onMigrate = false;
+    bool onSteal = false;
+    bool onFork = false;
+
+    bool armed() const
+    {
+        return at >= 0 || pid >= 0 || rdyOver >= 0 || onKill || onMigrate || onSteal || onFork;
+    }
+
+    // one --break-* argument:
+    //   --break-at=T  --break-state=PID:NEW|RDY|RUN|BLK|TRM  --break-rdy=N
+    //   --break-on=kill,migrate,steal,fork (any subset)
+    bool parseArg(const std::string &arg, std::string &err);
+};
@@ -0,0 +1,246 @@
+#include "core/Cluster.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+static const char *policyName(RoutePolicy p)
+{
+    switch (p)
+    {
+    case RoutePolicy::RoundRobin:
+        return "rr";
+    case RoutePolicy::LeastEFT:
+        return "eft";
+    case RoutePolicy::PowerOfTwo:
+        return "p2c";
+    }
+    return "?";
+}
+
+Cluster::Cluster()
+    : nodeCount(0),
+      nodes(nullptr),
+      dlPolicy(DeadlinePolicy::Soft),
+      rdyKind(ReadyQueueKind::Radix),
+      waitReport(false),
+      horizon(0),
+      rrNext(0),
+      rng(0x9E3779B97F4A7C15ULL),
+      makespan(0) {}
+
+Cluster::~Cluster()
+{
+    delete[] nodes;
+
+    // jobs never routed (horizon reached) are still ours
+    Process *p = nullptr;
+    while (in.workload.popFront(p))
+        delete p;
+}
+
+bool Cluster::load(const std::string &clusterPath, std::string &err)
+{
+    if (!InputParser::parseCluster(clusterPath, in, err))
+        return false;
+
+    nodeCount = (int)in.nodeFiles.size();
+    nodes = new Scheduler[nodeCount];
+
+    int maxPid = 0;
+    for (Node<Process *> *n = in.workload.getHead(); n; n = n->next)
+        if (n->data->getPID() > maxPid)
+            maxPid = n->data->getPID();
+
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        nodes[i].setDeadlinePolicy(dlPolicy);
+        nodes[i].setReadyQueueKind(rdyKind);
+        nodes[i].setWaitReport(waitReport);
+        nodes[i].setHorizon(horizon);
+        if (!nodes[i].load(in.nodeFiles[i], err))
+        {
+            err = "node " + std::to_string(i) + ": " + err;
+            return false;
+        }
+        nodes[i].reservePids(maxPid);
+        nodes[i].seedForkRng((std::uint32_t)i + 1);
+    }
+    return true;
+}
+
+void Cluster::printLoadedSummary() const
+{
+    std::cout << "=== Cluster Loaded Successfully ===\n";
+    std::cout << "Nodes=" << nodeCount << " Policy=" << policyName(in.policy)
+              << " NetworkDelay=" << in.netDelay << " Workload (M)=" << in.M << "\n";
+    for (int i = 0; i < nodeCount; ++i)
+        std::cout << "  Node " << i << ": " << in.nodeFiles[i] << "\n";
+    std::cout << "===================================\n";
+}
+
+int Cluster::pickNode(const long long *eft)
+{
+    switch (in.policy)
+    {
+    case RoutePolicy::RoundRobin:
+    {
+        int i = rrNext;
+        rrNext = (rrNext + 1) % nodeCount;
+        return i;
+    }
+    case RoutePolicy::LeastEFT:
+    {
+        int best = 0;
+        for (int i = 1; i < nodeCount; ++i)
+            if (eft[i] < eft[best])
+                best = i;
+        return best;
+    }
+    case RoutePolicy::PowerOfTwo:
+    {
+        if (nodeCount == 1)
+            return 0;
+        // xorshift64
+        auto next = [&]()
+        {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            return (int)(rng % (std::uint64_t)nodeCount);
+        };
+        int a = next();
+        int b = next();
+        while (b == a)
+            b = next();
+        return (eft[b] < eft[a] || (eft[b] == eft[a] && b < a)) ? b : a;
+    }
+    }
+    return 0;
+}
+
+void Cluster::routeArrivals(long long t)
+{
+    std::vector<long long> eft(nodeCount);
+    while (true)
+    {
+        auto *head = in.workload.getHead();
+        if (!head || head->data->getAT() != t)
+            break;
+
+        Process *p = nullptr;
+        in.workload.popFront(p);
+        if (needsNodeState())
+            for (int i = 0; i < nodeCount; ++i)
+                eft[i] = nodes[i].bestFinishTime(p->getRemaining());
+        nodes[pickNode(eft.data())].inject(p, t + in.netDelay);
+    }
+}
+
+void Cluster::simulate(UIMode mode)
+{
+    auto allDone = [&]()
+    {
+        if (!in.workload.empty())
+            return false;
+        for (int i = 0; i < nodeCount; ++i)
+            if (!nodes[i].isDone())
+                return false;
+        return true;
+    };
+
+    long long t = 0;
+    while (!allDone() && !pastHorizon(t))
+    {
+        routeArrivals(t);
+        for (int i = 0; i < nodeCount; ++i)
+            nodes[i].step(t);
+
+        if (mode != UIMode::Silent)
+        {
+            for (int i = 0; i < nodeCount; ++i)
+            {
+                std::cout << "\n################ Node " << i << " ################";
+                nodes[i].printSnapshot(t);
+            }
+        }
+        Scheduler::waitMode(mode);
+
+        ++t;
+    }
+    makespan = t;
+
+    std::vector<RunTotals> tot(nodeCount);
+    std::vector<int> routedCount(nodeCount);
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        nodes[i].writeOutputFile("data/output_node" + std::to_string(i) + ".txt");
+        tot[i] = nodes[i].totals();
+        routedCount[i] = nodes[i].getRoutedCount();
+    }
+    writeSummary("data/output.txt", tot.data(), routedCount.data());
+}
+
+void Cluster::writeSummary(const std::string &path, const RunTotals *tot, const int *routedCount) const
+{
+    std::ofstream out(path);
+    if (!out)
+        return;
+
+    out << "--- Cluster ---\n";
+    out << "Nodes: " << nodeCount << " Policy: " << policyName(in.policy)
+        << " Network delay: " << in.netDelay << "\n";
+    out << "Makespan: " << makespan << "\n";
+
+    RunTotals all;
+    int routedAll = 0;
+    int unrouted = 0;
+    for (Node<Process *> *n = in.workload.getHead(); n; n = n->next)
+        ++unrouted;
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        const RunTotals &r = tot[i];
+        long long total = r.busy + r.idle;
+
+        out << "Node " << i << " (" << in.nodeFiles[i] << "): routed=" << routedCount[i]
+            << " n=" << r.count;
+        if (r.count > 0)
+            out << " Avg WT=" << (double)r.sumWT / r.count
+                << " Avg RT=" << (double)r.sumRT / r.count
+                << " Avg TRT=" << (double)r.sumTRT / r.count;
+        out << " util%=" << ((total > 0) ? 100.0 * r.busy / total : 0.0) << "\n";
+
+        routedAll += routedCount[i];
+        all.count += r.count;
+        all.sumWT += r.sumWT;
+        all.sumRT += r.sumRT;
+        all.sumTRT += r.sumTRT;
+        all.dlDone += r.dlDone;
+        all.dlMet += r.dlMet;
+        all.busy += r.busy;
+        all.idle += r.idle;
+        all.unterminated += r.unterminated;
+    }
+
+    out << "\n--- Aggregate ---\n";
+    out << "Total Processes: " << all.count << " (routed: " << routedAll << ")\n";
+    if (all.unterminated + unrouted > 0)
+    {
+        out << "WARNING: stopped at horizon t=" << makespan << ", " << all.unterminated
+            << " processes not terminated, " << unrouted << " never routed (not counted below)\n";
+        std::cerr << "WARNING: horizon reached at t=" << makespan << " with "
+                  << all.unterminated + unrouted << " cluster processes not terminated\n";
+    }
+    if (all.count > 0)
+    {
+        out << "Avg WT: " << (double)all.sumWT / all.count << "\n";
+        out << "Avg RT: " << (double)all.sumRT / all.count << "\n";
+        out << "Avg TRT: " << (double)all.sumTRT / all.count << "\n";
+    }
+    if (all.dlDone > 0)
+        out << "Completed before deadline: " << 100.0 * all.dlMet / all.dlDone
+            << "% (" << all.dlMet << "/" << all.dlDone << ")\n";
+    else
+        out << "Completed before deadline: N/A (no deadlines)\n";
+    long long total = all.busy + all.idle;
+    out << "Utilization: " << ((total > 0) ? 100.0 * all.busy / total : 0.0) << "%\n";
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "core/Scheduler.h"
+
+// Several Schedulers (nodes), each with its own processor mix, stepped in
+// lock-step on one clock. A global dispatcher routes the shared workload:
+// every arrival is sent to one node and reaches it netDelay ticks later.
+class Cluster
+{
+private:
+    ClusterInput in;
+    int nodeCount;
+    Scheduler *nodes;
+
+    DeadlinePolicy dlPolicy;
+    ReadyQueueKind rdyKind;
+    bool waitReport;
+    long long horizon; // 0: no limit
+
+    int rrNext;
+    std::uint64_t rng; // p2c sampling; separate from std::rand so node forking is unaffected
+    long long makespan;
+
+    bool needsNodeState() const { return in.policy != RoutePolicy::RoundRobin; }
+    // eft[i]: node i's bestFinishTime for the job (only read if needsNodeState())
+    int pickNode(const long long *eft);
+    void routeArrivals(long long t);
+    bool pastHorizon(long long t) const { return horizon > 0 && t >= horizon; }
+    void writeSummary(const std::string &path, const RunTotals *tot, const int *routedCount) const;
+
+public:
+    Cluster();
+    ~Cluster();
+
+    Cluster(const Cluster &) = delete;
+    Cluster &operator=(const Cluster &) = delete;
+
+    // applied to every node at load()
+    void setDeadlinePolicy(DeadlinePolicy p) { dlPolicy = p; }
+    void setReadyQueueKind(ReadyQueueKind k) { rdyKind = k; }
+    void setWaitReport(bool on) { waitReport = on; }
+    void setHorizon(long long h) { horizon = h; }
+
+    bool load(const std::string &clusterPath, std::string &err);
+    void printLoadedSummary() const;
+    void simulate(UIMode mode);
+};
@@ -0,0 +1,139 @@
+#include "core/LiveStats.h"
+#include <csignal>
+#include <cstring>
+#include <new>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static const char LIVE_MAGIC[8] = {'P', 'S', 'L', 'I', 'V', 'E', '1', '\0'};
+
+static volatile std::sig_atomic_t snapshotRequested = 0;
+
+LiveStats::LiveStats()
+    : map(nullptr), mapSize(0), block(nullptr), cpus(nullptr), procs(0),
+      interval(1), nextT(0), lastT(-1) {}
+
+LiveStats::~LiveStats()
+{
+    close();
+}
+
+#ifndef _WIN32
+bool LiveStats::open(const std::string &path, int processors, int every, std::string &err)
+{
+    if (every <= 0)
+    {
+        err = "live stats interval must be > 0";
+        return false;
+    }
+    close();
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        err = "Cannot open live stats file: " + path;
+        return false;
+    }
+    mapSize = sizeof(LiveBlock) + sizeof(LiveCpu) * (std::size_t)processors;
+    if (::ftruncate(fd, (off_t)mapSize) != 0)
+    {
+        ::close(fd);
+        err = "Cannot size live stats file: " + path;
+        return false;
+    }
+    map = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+    {
+        map = nullptr;
+        err = "Cannot map live stats file: " + path;
+        return false;
+    }
+
+    // the file starts zeroed: seq = 0 and no update yet
+    block = new (map) LiveBlock();
+    cpus = reinterpret_cast<LiveCpu *>(block + 1);
+    procs = processors;
+    block->version = LIVE_VERSION;
+    block->procs = (std::uint32_t)procs;
+    std::memcpy(block->magic, LIVE_MAGIC, sizeof LIVE_MAGIC);
+
+    interval = every;
+    nextT = 0;
+    lastT = -1;
+    lastWall = std::chrono::steady_clock::now();
+
+    std::size_t slash = path.find_last_of('/');
+    snapshotDir = (slash == std::string::npos) ? "." : path.substr(0, slash);
+    return true;
+}
+
+void LiveStats::close()
+{
+    if (map)
+        ::munmap(map, mapSize);
+    map = nullptr;
+    block = nullptr;
+    cpus = nullptr;
+}
+
+void LiveStats::installSnapshotSignal()
+{
+    struct sigaction sa;
+    std::memset(&sa, 0, sizeof sa);
+    sa.sa_handler = [](int)
+    { snapshotRequested = 1; };
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    ::sigaction(SIGUSR1, &sa, nullptr);
+}
+#else
+bool LiveStats::open(const std::string &, int, int, std::string &err)
+{
+    err = "live stats need mmap (POSIX only)";
+    return false;
+}
+
+void LiveStats::close() {}
+
+void LiveStats::installSnapshotSignal() {}
+#endif
+
+LiveBlock *LiveStats::beginUpdate()
+{
+    std::uint32_t s = block->seq.load(std::memory_order_relaxed);
+    block->seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return block;
+}
+
+void LiveStats::endUpdate(long long t)
+{
+    auto now = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(now - lastWall).count();
+    block->ticksPerSec = (secs > 0 && lastT >= 0) ? (t - lastT) / secs : 0.0;
+    block->t = t;
+    ++block->updates;
+    block->seq.store(block->seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    lastWall = now;
+    lastT = t;
+    nextT = t + interval;
+}
+
+bool LiveStats::takeSnapshotRequest()
+{
+    if (!snapshotRequested)
+        return false;
+    snapshotRequested = 0;
+    return true;
+}
+
+std::string LiveStats::snapshotPath(long long t) const
+{
+    return snapshotDir + "/snapshot_t" + std::to_string(t) + ".txt";
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Live view of a running simulation in a memory-mapped file: a LiveBlock
+// followed by one LiveCpu per processor. The writer updates it every
+// `interval` ticks under a seqlock (seq is odd while an update is in
+// progress), so readers in other processes never block the run. Readers
+// copy the block, then retry if seq was odd or changed meanwhile.
+// Layout changes bump LIVE_VERSION.
+constexpr std::uint32_t LIVE_VERSION = 1;
+
+struct LiveBlock
+{
+    char magic[8]; // "PSLIVE1\0"
+    std::uint32_t version;
+    std::uint32_t procs;
+    std::atomic<std::uint32_t> seq;
+    std::uint32_t reserved;
+
+    std::int64_t t; // last tick published
+    std::int64_t updates;
+    double ticksPerSec; // since the previous update
+    std::int64_t terminated, total;
+    std::int64_t migRTF, migMaxW, steals, forks, kills, aborted;
+};
+
+struct LiveCpu
+{
+    std::int32_t type; // ProcType
+    std::int32_t runPid; // -1 idle
+    std::int64_t ready;
+    std::int64_t busy, idle;
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "seqlock needs a lock-free counter");
+static_assert(sizeof(LiveBlock) % 8 == 0, "LiveCpu rows must stay aligned");
+
+class LiveStats
+{
+private:
+    void *map;
+    std::size_t mapSize;
+    LiveBlock *block;
+    LiveCpu *cpus;
+    int procs;
+
+    long long interval;
+    long long nextT;
+    long long lastT;
+    std::chrono::steady_clock::time_point lastWall;
+
+    std::string snapshotDir;
+
+public:
+    LiveStats();
+    ~LiveStats();
+
+    LiveStats(const LiveStats &) = delete;
+    LiveStats &operator=(const LiveStats &) = delete;
+
+    // creates / truncates `path`; snapshots requested with SIGUSR1 go next to it
+    bool open(const std::string &path, int processors, int every, std::string &err);
+    void close();
+    bool isOpen() const { return block != nullptr; }
+
+    bool due(long long t) const { return t >= nextT; }
+
+    // writer: fill the fields between beginUpdate() and endUpdate(t)
+    LiveBlock *beginUpdate();
+    LiveCpu *cpu(int i) { return cpus + i; }
+    void endUpdate(long long t);
+
+    // SIGUSR1: set by the handler, consumed at the next tick boundary
+    static void installSnapshotSignal();
+    static bool takeSnapshotRequest();
+    std::string snapshotPath(long long t) const;
+};
@@ -0,0 +1,122 @@
+#include "core/Sampler.h"
+
+static const char SAMPLE_MAGIC[8] = {'P', 'S', 'S', 'A', 'M', 'P', '2', '\0'};
+
+Sampler::Sampler()
+    : binary(false), procs(0), frameSize(0),
+      ring(nullptr), capacity(0), count(0),
+      interval(1), budget(0), takenAtInterval(0), nextT(0), lastT(-1),
+      lastCompleted(0), lastSteals(0), frames(0) {}
+
+Sampler::~Sampler()
+{
+    close();
+    delete[] ring;
+}
+
+bool Sampler::open(const std::string &path, int processors, int every, int maxPerInterval,
+                   std::string &err)
+{
+    if (every <= 0 || maxPerInterval <= 0)
+    {
+        err = "sample interval and budget must be > 0";
+        return false;
+    }
+
+    binary = path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+    out.open(path, binary ? std::ios::binary : std::ios::out);
+    if (!out)
+    {
+        err = "Cannot open sample file: " + path;
+        return false;
+    }
+
+    procs = processors;
+    frameSize = ROW_FIELDS + CPU_FIELDS * procs;
+    // ~1 MB of frames, at least 16
+    capacity = (int)((1u << 18) / (unsigned)frameSize);
+    if (capacity < 16)
+        capacity = 16;
+    delete[] ring;
+    ring = new std::int64_t[(std::size_t)capacity * frameSize];
+    count = 0;
+
+    interval = every;
+    budget = maxPerInterval;
+    takenAtInterval = 0;
+    nextT = 0;
+    lastT = -1;
+    lastCompleted = lastSteals = 0;
+    frames = 0;
+
+    if (binary)
+    {
+        std::int32_t hdr[2] = {ROW_FIELDS, procs};
+        out.write(SAMPLE_MAGIC, sizeof SAMPLE_MAGIC);
+        out.write(reinterpret_cast<const char *>(hdr), sizeof hdr);
+    }
+    else
+    {
+        out << "t,window,completions,steals,blk,io_pid,io_remaining";
+        for (int i = 0; i < procs; ++i)
+            out << ",P" << i << "_rdy,P" << i << "_eft,P" << i << "_run";
+        out << "\n";
+    }
+    return true;
+}
+
+void Sampler::commit()
+{
+    std::int64_t *f = frame();
+    long long t = f[F_T];
+
+    f[F_WINDOW] = t - lastT;
+    std::int64_t completed = f[F_COMPLETIONS], steals = f[F_STEALS];
+    f[F_COMPLETIONS] = completed - lastCompleted;
+    f[F_STEALS] = steals - lastSteals;
+    lastCompleted = completed;
+    lastSteals = steals;
+    lastT = t;
+
+    ++frames;
+    if (++count == capacity)
+        flush();
+
+    if (++takenAtInterval == budget)
+    {
+        takenAtInterval = 0;
+        interval *= 2;
+    }
+    nextT = t + interval;
+}
+
+void Sampler::flush()
+{
+    if (count == 0 || !out)
+        return;
+    if (binary)
+    {
+        out.write(reinterpret_cast<const char *>(ring),
+                  (std::streamsize)((std::size_t)count * frameSize * sizeof(std::int64_t)));
+    }
+    else
+    {
+        for (int r = 0; r < count; ++r)
+        {
+            const std::int64_t *f = ring + (std::size_t)r * frameSize;
+            out << f[0];
+            for (int k = 1; k < frameSize; ++k)
+                out << ',' << f[k];
+            out << '\n';
+        }
+    }
+    count = 0;
+}
+
+void Sampler::close()
+{
+    if (!out.is_open())
+        return;
+    flush();
+    out.close();
+}
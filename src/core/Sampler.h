@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// Time series of scheduler state, one frame every `interval` ticks.
+// Frames go to a preallocated ring of frame slots that is flushed to the
+// file when it fills up, so sampling itself never allocates or does I/O.
+// After `budget` frames at one interval the interval doubles: a long run
+// keeps full resolution early and costs O(budget * log(T)) frames overall.
+//
+// Frame layout (int64): t, window, completions, steals, blk, ioPid,
+// ioRemaining, then per processor: ready count, EFT, RUN pid (-1 idle).
+// `window` is the number of ticks since the previous frame; completions
+// and steals are counted over that window.
+class Sampler
+{
+public:
+    static constexpr int ROW_FIELDS = 7;
+    static constexpr int CPU_FIELDS = 3;
+
+    enum Field
+    {
+        F_T,
+        F_WINDOW,
+        F_COMPLETIONS,
+        F_STEALS,
+        F_BLK,
+        F_IO_PID,
+        F_IO_REMAINING
+    };
+
+private:
+    std::ofstream out;
+    bool binary;
+    int procs;
+    int frameSize; // int64 values per frame
+
+    std::int64_t *ring; // capacity frames
+    int capacity;
+    int count;
+
+    long long interval;
+    int budget;
+    int takenAtInterval;
+    long long nextT;
+    long long lastT;
+
+    std::int64_t lastCompleted; // cumulative values at the previous frame
+    std::int64_t lastSteals;
+    long long frames;
+
+    void flush();
+
+public:
+    Sampler();
+    ~Sampler();
+
+    Sampler(const Sampler &) = delete;
+    Sampler &operator=(const Sampler &) = delete;
+
+    // path ending in ".bin" selects the binary format, anything else CSV
+    bool open(const std::string &path, int processors, int every, int maxPerInterval,
+              std::string &err);
+    void close();
+
+    bool due(long long t) const { return t >= nextT; }
+
+    // frame slot to fill (completions / steals as cumulative counts; the
+    // window fields are derived in commit)
+    std::int64_t *frame() { return ring + (std::size_t)count * frameSize; }
+    void commit();
+
+    long long getFrames() const { return frames; }
+    long long lastSampled() const { return lastT; }
+};
@@ -1,11 +1,28 @@
 #pragma once
 #include <string>
 #include <ostream>
+#include <iostream>
+#include <vector>
+#include <cstdint>
 #include "io/InputParser.h"
+#include "io/OnlineFeed.h"
 #include "processors/Processor.h"
 #include "processors/FCFSProcessor.h"
+#include "processors/SJFProcessor.h"
+#include "processors/RRProcessor.h"
+#include "processors/EDFProcessor.h"
+#include "processors/MLFQProcessor.h"
+#include "processors/CFSProcessor.h"
+#include "processors/LLFProcessor.h"
+#include "ds/FixedArray.h"
 #include "ds/Queue.h"
 #include "ds/LinkedList.h"
+#include "ds/TimingWheel.h"
+#include "core/SchedulerObserver.h"
+#include "core/Sampler.h"
+#include "core/Breakpoints.h"
+#include "core/LiveStats.h"
+#include "core/TaskGenerator.h"
 
 enum class UIMode
 {
@@ -13,20 +30,54 @@ enum class UIMode
     Step,
     Silent
 };
-enum class TermReason
+// Soft: deadlines are only reported. Firm: a job that can no longer meet its
+// deadline is worthless and is aborted as soon as that becomes certain.
+enum class DeadlinePolicy
 {
-    NORMAL,
-    SIGKILL,
-    ORPHAN
+    Soft,
+    Firm
 };
 
-class Scheduler
+// TRM totals, for aggregating several Schedulers (see Cluster)
+struct RunTotals
+{
+    int count = 0;
+    long long sumWT = 0, sumRT = 0, sumTRT = 0;
+    int dlDone = 0, dlMet = 0;
+    long long busy = 0, idle = 0;
+    int forked = 0, killed = 0;
+    int migRTF = 0, migMaxW = 0, steals = 0;
+    int aborted = 0;
+    long long ticks = 0;
+    int unterminated = 0; // still in the system when the horizon stopped the run
+};
+
+// Observer receives the scheduling events (see SchedulerObserver.h).
+// Member definitions live in SchedulerImpl.h; Scheduler (NullObserver) is
+// instantiated once in Scheduler.cpp.
+template <typename Observer = NullObserver>
+class BasicScheduler
 {
 private:
     ParsedInput in;
+    Observer obs;
 
     int totalProcs;
-    Processor **processors;
+    Processor **processors; // P0..Pn-1 by global index, pointing into the typed arrays below
+
+    // per-type contiguous storage (global order: FCFS, SJF, RR, EDF, MLFQ, CFS, LLF)
+    FixedArray<FCFSProcessor> fcfsCPUs;
+    FixedArray<SJFProcessor> sjfCPUs;
+    FixedArray<RRProcessor> rrCPUs;
+    FixedArray<EDFProcessor> edfCPUs;
+    FixedArray<MLFQProcessor> mlfqCPUs;
+    FixedArray<CFSProcessor> cfsCPUs;
+    FixedArray<LLFProcessor> llfCPUs;
+
+    CpuTracker tracker; // clock + running / idle-with-work bitsets shared with processors
+
+    ReadyQueueKind rdyKind; // RDY container of SJF/EDF processors
+    std::int32_t maxSpeed;  // fastest processor (SPEED_ONE units)
 
     // BLK waiting queue + single IO device
     Queue<Process *> blkWait;
@@ -37,6 +88,8 @@ private:
     LinkedList<Process *> trm;
     int trmCount;
 
+    long long horizon; // run() / runUntil() stop before this tick, 0: no limit
+
     int nextPid;      // next PID for forked children
     int totalCreated; // total processes including forked children (stop condition)
 
@@ -48,53 +101,231 @@ private:
 
     Node<KillEvent> *killCur; // pointer iterator over kill events list
 
+    // processes handed over by a cluster dispatcher or an online feed,
+    // admitted at `at` (sorted by at, FIFO among equal ones)
+    struct RoutedArrival
+    {
+        long long at;
+        Process *p;
+    };
+    LinkedList<RoutedArrival> routed;
+    int routedCount;
+    LinkedList<KillEvent> routedKills; // handed-over SIGKILLs, sorted by time
+
+    // jobs of the input's periodic / sporadic tasks, created as they arrive;
+    // released jobs join allProcesses like any other (the output needs them)
+    TaskGenerator taskJobs;
+    long long nextTick; // runUntil() resumes here
+
+    // fork decisions: std::rand unless seeded, so a node's run does not
+    // depend on other Schedulers drawing from the same global stream
+    bool forkSeeded;
+    std::uint32_t forkState;
+    int forkRoll();
+
+    Sampler *sampler; // optional time series, not owned
+    void takeSample(long long t);
+
+    LiveStats *live; // optional live stats block + SIGUSR1 snapshots, not owned
+    void publishLive(long long t);
+    void liveTick(long long t); // publish if due, snapshot if requested
+    void writeSnapshotFile(long long t) const;
+
+    bool waitReport; // append the tail wait-cause section to the output file
+    void writeWaitReport(std::ostream &out) const;
+    // one row of the per-process table
+    static constexpr const char *TRM_COLUMNS = "TT PID AT CT DL IO_D WT RT TRT RDY BLKW IO RUN\n";
+    static void writeTrmRow(std::ostream &out, const Process *p);
+    void warnIfUnterminated() const;
+
+    // interactive / step runs with breakpoints: what the last check saw
+    Breakpoints brk;
+    Process *brkProc; // brk.pid once it exists (forked children and task jobs appear later)
+    ProcState brkLastState;
+    bool brkRdyOver;
+    int brkKills, brkMigrations, brkSteals, brkForks;
+    int brkCreated; // totalCreated at the last check
+    void resetBreakWatch();
+    bool breakHit(long long t, std::string &why);
+    // commands after a stop; true: fast-forward to the next break
+    bool debugPrompt(long long t);
+    Process *findProcess(int pid) const;
+    void printProcess(const Process *p) const;
+    void printProcessor(int i, std::ostream &os = std::cout) const;
+
+    // where the last encoded snapshot left NEW / TRM
+    struct SnapshotCursor
+    {
+        bool newSent = false;
+        Node<Process *> *trmLast = nullptr;
+    };
+    void encodeSnapshot(long long t, SnapshotCursor &cur, std::vector<std::int64_t> &rec) const;
+    void encodeProcessor(int i, std::vector<std::int64_t> &rec) const;
+
+    // firm deadlines: one timer per process at the first tick it could turn hopeless
+    DeadlinePolicy dlPolicy;
+    TimingWheel<Process *> dlWheel;
+    int dlAborted;
+    long long dlSavedCPU; // remaining CT of aborted jobs (CPU time not spent on them)
+
     // ===== existing helpers =====
     void buildProcessors();
-    int pickBestProcessorIndex() const;
+    // least time until `work` more units would be done (queue + own run time)
+    int pickBestProcessorIndex(long long work) const;
 
-    void waitMode(UIMode mode) const;
-    void printSnapshot(int t) const;
+    // run f on every typed processor array, in global index order
+    template <typename F>
+    void forEachGroup(F &&f);
 
     // ===== Phase2 core steps you already have =====
-    void admitArrivals(int t);
-    void dispatchIdleCPUs(int t);
+    void admitArrivals(long long t);
+    void admitOne(Process *p, long long t);
+    void dispatchIdleCPUs(long long t);
     void executeOneTick();
-    void postCpuTransitions(int t);
-    void finishIOIfDone(int t);
-    void startIOIfPossible();
+    void postCpuTransitions(long long t);
+    void finishIOIfDone(long long t);
+    void startIOIfPossible(long long t);
 
     void initNextPid();
+    void initLoaded();
+
+    // time of a state transition: t before the tick of step t executes, t + 1 after
+    long long now() const { return tracker.now; }
+
+    void terminateProcess(Process *p, long long tt, TermReason why);
+
+    bool killByPIDinFCFS(int pid, long long tt, TermReason why);
+    void applySigKill(long long t);
 
-    void terminateProcess(Process *p, int tt, TermReason why);
+    void attemptForking(long long t);
 
-    bool killByPIDinFCFS(int pid, int tt, TermReason why);
-    void applySigKill(int t);
+    void armDeadline(Process *p, long long t, int remaining);
+    long long fastestTimeFor(long long work) const;
+    void expireDeadlines(long long t);
+    void abortForDeadline(Process *p, long long t);
 
-    void attemptForking(int t);
+    void boostMLFQIfDue(long long t);
+    void llfPreemptIfNeeded(long long t);
 
-    bool tryMigrateOnDispatch(Processor *from, Process *p, int t);
+    // put the RDY top on cpu's CPU, sending the RUN process back to RDY
+    template <typename CPU>
+    void preemptRunning(CPU &cpu, long long t);
 
-    void workStealIfNeeded(int t);
+    template <typename CPU>
+    bool tryMigrateOnDispatch(const CPU &from, Process *p, long long t);
+
+    void workStealIfNeeded(long long t);
 
     // helper selection
-    int pickShortestByType(ProcType tp) const;
-    int pickShortestFCFS() const;
+    template <typename CPU>
+    static CPU *pickShortest(FixedArray<CPU> &group, long long work);
     int findLongestByEFT() const;
     int findShortestByEFT() const;
 
-    // output
-    void writeOutputFile(const std::string &path) const;
-
 public:
-    Scheduler();
-    ~Scheduler();
+    BasicScheduler();
+    ~BasicScheduler();
+
+    BasicScheduler(const BasicScheduler &) = delete;
+    BasicScheduler &operator=(const BasicScheduler &) = delete;
+
+    int processorCount() const { return totalProcs; }
+    const SimConfig &config() const { return in; }
+
+    // sample every sampler-chosen tick from now on (nullptr: off)
+    void attachSampler(Sampler *s) { sampler = s; }
+    // publish live stats from run() (nullptr: off)
+    void attachLiveStats(LiveStats *l) { live = l; }
+
+    Observer &observer() { return obs; }
+    const Observer &observer() const { return obs; }
 
     bool load(const std::string &inputPath, std::string &err);
+    // workload from memory instead of an input file (see InputParser::build)
+    bool load(const SimConfig &cfg,
+              const ProcessSpec *procs, int n,
+              const KillEvent *kills, int nk,
+              std::string &err);
+
+    void setDeadlinePolicy(DeadlinePolicy p) { dlPolicy = p; }
+    void setWaitReport(bool on) { waitReport = on; }
+    // interactive / step modes run without snapshots until one fires
+    void setBreakpoints(const Breakpoints &b) { brk = b; }
+
+    // stop runs before tick h even if processes are left (0: run to completion)
+    void setHorizon(long long h) { horizon = h; }
+    long long getHorizon() const { return horizon; }
+    bool pastHorizon(long long t) const { return horizon > 0 && t >= horizon; }
+    // processes not terminated yet (routed ones included)
+    int unterminatedCount() const { return totalCreated - trmCount; }
+
+    // takes effect at the next load()
+    void setReadyQueueKind(ReadyQueueKind k) { rdyKind = k; }
 
     void printLoadedSummary() const;
 
     // FINAL function name
     void simulate(UIMode mode);
+    // simulate without writing the output file; results via totals() / writeOutputFile()
+    void run(UIMode mode);
+    // silent run fed by `feed` while it goes; ends once the input is closed
+    // and every process has terminated (or at the horizon). Each process is
+    // written to `stream` as it terminates. Forked children get PIDs from
+    // ONLINE_FORK_PIDS up.
+    void runOnline(OnlineFeed &feed, std::ostream &stream);
+    static constexpr int ONLINE_FORK_PIDS = 1000000000;
+    // runOnline, then the output file like simulate()
+    void simulateOnline(OnlineFeed &feed, std::ostream &stream);
+
+    // pause / resume: silent steps from where the last call stopped up to
+    // (not including) tick T
+    void runUntil(long long T);
+    long long currentTick() const { return nextTick; }
+
+    // Deep copy of the simulation as it stands; runUntil() continues the
+    // copy from the same tick. branch() also takes cfg's processor counts
+    // (which may only grow; new processors start idle) and its RTF, MaxW,
+    // STL, time slice and ForkProb, the rest of the config is kept. The
+    // observer starts fresh; sampler, live stats and breakpoints are not
+    // copied. The caller owns the copy; nullptr + err on failure.
+    BasicScheduler *clone() const;
+    BasicScheduler *branch(const SimConfig &cfg, std::string &err) const;
+
+    // every process, terminated or not: input order, then forked children
+    template <typename F>
+    void forEachProcess(F &&f) const
+    {
+        for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+            f(static_cast<const Process *>(n->data));
+    }
+
+    // one tick at a time, for drivers running several Schedulers in lock-step
+    void step(long long t);
+    bool isDone() const { return trmCount >= totalCreated && routed.empty() && taskJobs.empty(); }
 
-    void edfPreemptIfNeeded(Processor *cpu, int t);
+    // hand over a process created elsewhere; it arrives here at tick `at`
+    // (>= the next tick stepped) and this Scheduler takes ownership
+    void inject(Process *p, long long at);
+    // same for a SIGKILL, applied at k.time (>= the next tick stepped)
+    void injectKill(const KillEvent &k);
+    void seedForkRng(std::uint32_t seed)
+    {
+        forkSeeded = true;
+        forkState = seed;
+    }
+    // keep forked PIDs above this one (PIDs of processes injected later)
+    void reservePids(int maxPid);
+    // earliest time any processor here could finish `work` more units
+    long long bestFinishTime(long long work) const;
+    int getRoutedCount() const { return routedCount; }
+    RunTotals totals() const;
+
+    static void waitMode(UIMode mode);
+    void printSnapshot(long long t, std::ostream &os = std::cout) const;
+    void writeOutputFile(const std::string &path) const;
+
+    void edfPreemptIfNeeded(EDFProcessor &cpu, long long t);
 };
+
+using Scheduler = BasicScheduler<>;
+extern template class BasicScheduler<NullObserver>;
@@ -0,0 +1,2027 @@
+#pragma once
+// Member definitions of BasicScheduler. Scheduler.cpp instantiates the
+// default (NullObserver) scheduler; include this header in the translation
+// unit that instantiates a scheduler with an observer of its own.
+#include "core/Scheduler.h"
+#include "core/SnapshotWriter.h"
+#include "model/Process.h"
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <type_traits>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+// Static dispatch on a processor's concrete type (replaces the old vtable).
+template <typename F>
+decltype(auto) visitCPU(Processor *cpu, F &&f)
+{
+    switch (cpu->getType())
+    {
+    case ProcType::FCFS:
+        return f(*static_cast<FCFSProcessor *>(cpu));
+    case ProcType::SJF:
+        return f(*static_cast<SJFProcessor *>(cpu));
+    case ProcType::RR:
+        return f(*static_cast<RRProcessor *>(cpu));
+    case ProcType::EDF:
+        return f(*static_cast<EDFProcessor *>(cpu));
+    case ProcType::MLFQ:
+        return f(*static_cast<MLFQProcessor *>(cpu));
+    case ProcType::CFS:
+        return f(*static_cast<CFSProcessor *>(cpu));
+    default:
+        return f(*static_cast<LLFProcessor *>(cpu));
+    }
+}
+
+template <typename CPU, ProcType T>
+constexpr bool isType = (std::decay_t<CPU>::kType == T);
+
+// Visit the processors of one typed group whose bit is set, in ID order.
+// Groups hold consecutive IDs, so this scans only the group's bit range.
+template <typename CPU, typename F>
+void forEachSet(const BitSet &bits, FixedArray<CPU> &group, F &&f)
+{
+    if (group.empty())
+        return;
+    std::size_t base = (std::size_t)group[0].getID();
+    std::size_t end = base + group.size();
+    for (std::size_t i = bits.next(base, end); i < end; i = bits.next(i + 1, end))
+        f(group[i - base]);
+}
+
+// ================= Scheduler =================
+template <typename Obs>
+BasicScheduler<Obs>::BasicScheduler()
+    : totalProcs(0),
+      processors(nullptr),
+      rdyKind(ReadyQueueKind::Radix),
+      maxSpeed(SPEED_ONE),
+      ioDev(nullptr),
+      ioRemaining(0),
+      trmCount(0),
+      horizon(0),
+      routedCount(0),
+      nextTick(0),
+      forkSeeded(false),
+      forkState(0),
+      sampler(nullptr),
+      live(nullptr),
+      waitReport(false),
+      brkProc(nullptr),
+      brkLastState(ProcState::NEW),
+      brkRdyOver(false),
+      brkKills(0), brkMigrations(0), brkSteals(0), brkForks(0), brkCreated(0),
+      dlPolicy(DeadlinePolicy::Soft),
+      dlAborted(0),
+      dlSavedCPU(0) {}
+
+template <typename Obs>
+BasicScheduler<Obs>::~BasicScheduler()
+{
+    // processors[] only views the typed arrays, which free themselves
+    delete[] processors;
+
+    // free all processes
+    auto *node = in.allProcesses.getHead();
+    while (node)
+    {
+        delete node->data;
+        node = node->next;
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::buildProcessors()
+{
+    totalProcs = in.NF + in.NS + in.NR + in.NE + in.NM + in.NC + in.NL;
+    processors = new Processor *[totalProcs];
+
+    tracker.init(totalProcs);
+
+    fcfsCPUs.init(in.NF);
+    sjfCPUs.init(in.NS);
+    rrCPUs.init(in.NR);
+    edfCPUs.init(in.NE);
+    mlfqCPUs.init(in.NM);
+    cfsCPUs.init(in.NC);
+    llfCPUs.init(in.NL);
+
+    int idx = 0;
+
+    for (int i = 0; i < in.NF; ++i, ++idx)
+        processors[idx] = &fcfsCPUs.emplace(idx);
+
+    for (int i = 0; i < in.NS; ++i, ++idx)
+        processors[idx] = &sjfCPUs.emplace(idx, rdyKind);
+
+    for (int i = 0; i < in.NR; ++i, ++idx)
+        processors[idx] = &rrCPUs.emplace(idx);
+
+    for (int i = 0; i < in.NE; ++i, ++idx)
+        processors[idx] = &edfCPUs.emplace(idx, rdyKind);
+
+    for (int i = 0; i < in.NM; ++i, ++idx)
+        processors[idx] = &mlfqCPUs.emplace(idx, in.mlfqLevels, in.mlfqQuanta.data());
+
+    for (int i = 0; i < in.NC; ++i, ++idx)
+        processors[idx] = &cfsCPUs.emplace(idx, in.cfsLatency, in.cfsMinGran);
+
+    for (int i = 0; i < in.NL; ++i, ++idx)
+        processors[idx] = &llfCPUs.emplace(idx, in.llfHysteresis);
+
+    for (int i = 0; i < totalProcs; ++i)
+        processors[i]->attachTracker(&tracker);
+
+    if (in.powerEnabled)
+        for (int i = 0; i < totalProcs; ++i)
+            processors[i]->setPowerModel(in.idleThreshold, in.wakeLatency);
+
+    // per-processor speeds (empty = all 1.0)
+    maxSpeed = SPEED_ONE;
+    for (int i = 0; i < (int)in.speeds.size(); ++i)
+    {
+        processors[i]->setSpeed(in.speeds[i]);
+        if (i == 0 || in.speeds[i] > maxSpeed)
+            maxSpeed = in.speeds[i];
+    }
+
+    // set RR time slice (other types keep 0 = no quantum)
+    for (RRProcessor &rr : rrCPUs)
+        rr.setTimeSlice(in.timeSlice);
+}
+
+template <typename Obs>
+template <typename F>
+void BasicScheduler<Obs>::forEachGroup(F &&f)
+{
+    f(fcfsCPUs);
+    f(sjfCPUs);
+    f(rrCPUs);
+    f(edfCPUs);
+    f(mlfqCPUs);
+    f(cfsCPUs);
+    f(llfCPUs);
+}
+
+template <typename Obs>
+bool BasicScheduler<Obs>::load(const std::string &inputPath, std::string &err)
+{
+    if (!InputParser::parseFile(inputPath, in, err))
+        return false;
+    initLoaded();
+    return true;
+}
+
+template <typename Obs>
+bool BasicScheduler<Obs>::load(const SimConfig &cfg,
+                     const ProcessSpec *procs, int n,
+                     const KillEvent *kills, int nk,
+                     std::string &err)
+{
+    if (!InputParser::build(cfg, procs, n, kills, nk, in, err))
+        return false;
+    initLoaded();
+    return true;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::initLoaded()
+{
+    buildProcessors();
+
+    // Milestone D init:
+    killCur = in.killEvents.getHead();
+    taskJobs.init(in.tasks);
+    initNextPid();
+    totalCreated = in.M;
+
+    // reset counters
+    migRTF = migMaxW = stealMoves = forkedCreated = killedCount = 0;
+    dlAborted = 0;
+    dlSavedCPU = 0;
+    trmCount = 0;
+    ioDev = nullptr;
+    ioRemaining = 0;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::printLoadedSummary() const
+{
+    std::cout << "=== Input Loaded Successfully ===\n";
+    std::cout << "Processors: NF=" << in.NF << " NS=" << in.NS << " NR=" << in.NR << " NE=" << in.NE
+              << " NM=" << in.NM << " NC=" << in.NC << " NL=" << in.NL
+              << "  (Total=" << (in.NF + in.NS + in.NR + in.NE + in.NM + in.NC + in.NL) << ")\n";
+    std::cout << "RR TimeSlice=" << in.timeSlice << "\n";
+    if (in.NM > 0)
+    {
+        std::cout << "MLFQ Levels=" << in.mlfqLevels << " Boost=" << in.mlfqBoost << " Quanta=";
+        for (int i = 0; i < in.mlfqLevels; ++i)
+            std::cout << in.mlfqQuanta[i] << (i + 1 < in.mlfqLevels ? "," : "\n");
+    }
+    if (in.NC > 0)
+        std::cout << "CFS Latency=" << in.cfsLatency << " MinGran=" << in.cfsMinGran << "\n";
+    if (in.NL > 0)
+        std::cout << "LLF Hysteresis=" << in.llfHysteresis << "\n";
+    std::cout << "RTF=" << in.RTF << " MaxW=" << in.MaxW << " STL=" << in.STL
+              << " ForkProb=" << in.forkProb << "%\n";
+    std::cout << "Processes (M)=" << in.M << "\n";
+    if (!in.tasks.empty())
+        std::cout << "Periodic/sporadic tasks=" << in.tasks.size() << "\n";
+
+    std::cout << "First processes in NEW:\n";
+    int shown = 0;
+    auto *node = in.newList.getHead();
+    while (node && shown < 5)
+    {
+        Process *p = node->data;
+        std::cout << "  PID=" << p->getPID()
+                  << " AT=" << p->getAT()
+                  << " CT=" << p->getCT()
+                  << " IOcnt=" << p->getIOCount() << "\n";
+        node = node->next;
+        ++shown;
+    }
+
+    int kills = 0;
+    auto *kn = in.killEvents.getHead();
+    while (kn)
+    {
+        ++kills;
+        kn = kn->next;
+    }
+    std::cout << "SIGKILL events=" << kills << "\n";
+    std::cout << "===============================\n";
+}
+
+template <typename Obs>
+int BasicScheduler<Obs>::pickBestProcessorIndex(long long work) const
+{
+    int best = 0;
+    long long bestVal = processors[0]->expectedFinishTime() + processors[0]->timeFor(work);
+    for (int i = 1; i < totalProcs; ++i)
+    {
+        long long v = processors[i]->expectedFinishTime() + processors[i]->timeFor(work);
+        if (v < bestVal)
+        {
+            bestVal = v;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// ------------------ UI helpers ------------------
+template <typename Obs>
+void BasicScheduler<Obs>::waitMode(UIMode mode)
+{
+    if (mode == UIMode::Silent)
+        return;
+    if (mode == UIMode::Interactive)
+    {
+        std::cout << "Press Enter to continue...";
+        std::cin.get();
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::printSnapshot(long long t, std::ostream &os) const
+{
+    SnapshotCursor cur;
+    std::vector<std::int64_t> rec;
+    encodeSnapshot(t, cur, rec);
+    SnapshotRenderer().render(rec.data(), rec.size(), os);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::printProcessor(int i, std::ostream &os) const
+{
+    std::vector<std::int64_t> rec;
+    std::size_t len = snaprec::begin(rec, snaprec::REC_PROCESSOR);
+    encodeProcessor(i, rec);
+    snaprec::end(rec, len);
+    SnapshotRenderer().render(rec.data(), rec.size(), os);
+}
+
+// Snapshot as records (layout in core/SnapshotWriter.h): a REC_NEW_LIST the
+// first time, then what changed in NEW / TRM since `cur`, and everything else
+template <typename Obs>
+void BasicScheduler<Obs>::encodeSnapshot(long long t, SnapshotCursor &cur, std::vector<std::int64_t> &rec) const
+{
+    if (!cur.newSent)
+    {
+        std::size_t len = snaprec::begin(rec, snaprec::REC_NEW_LIST);
+        rec.push_back((std::int64_t)in.newList.size());
+        for (Node<Process *> *n = in.newList.getHead(); n; n = n->next)
+        {
+            rec.push_back(n->data->getPID());
+            rec.push_back(n->data->getAT());
+        }
+        snaprec::end(rec, len);
+        cur.newSent = true;
+    }
+
+    std::size_t len = snaprec::begin(rec, snaprec::REC_SNAPSHOT);
+    rec.push_back(t);
+    rec.push_back((std::int64_t)in.newList.size());
+    rec.push_back(ioDev ? ioDev->getPID() : -1);
+    rec.push_back(ioDev ? ioRemaining : 0);
+
+    rec.push_back((std::int64_t)blkWait.size());
+    for (Node<Process *> *b = blkWait.getHead(); b; b = b->next)
+    {
+        rec.push_back(b->data->getPID());
+        rec.push_back(b->data->getPendingIO());
+    }
+
+    std::size_t nTrmAt = rec.size();
+    rec.push_back(0);
+    Node<Process *> *tr = cur.trmLast ? cur.trmLast->next : trm.getHead();
+    for (; tr; tr = tr->next)
+    {
+        rec.push_back(tr->data->getPID());
+        rec.push_back(tr->data->getTT());
+        ++rec[nTrmAt];
+        cur.trmLast = tr;
+    }
+
+    rec.push_back(totalProcs);
+    for (int i = 0; i < totalProcs; ++i)
+        encodeProcessor(i, rec);
+    snaprec::end(rec, len);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::encodeProcessor(int i, std::vector<std::int64_t> &rec) const
+{
+    const Processor *cpu = processors[i];
+    rec.push_back(cpu->getID());
+    rec.push_back((std::int64_t)cpu->getType());
+
+    std::size_t nAt = rec.size();
+    rec.push_back(0);
+    visitCPU(processors[i], [&](auto &c)
+             { c.forEachReady([&](const Process *p, int level)
+                              {
+                                  rec.push_back(p->getPID());
+                                  rec.push_back(level);
+                                  ++rec[nAt]; }); });
+
+    Process *run = cpu->getRunning();
+    rec.push_back(run ? run->getPID() : -1);
+    rec.push_back(run ? cpu->getRunningRemaining() : 0);
+    rec.push_back(run ? cpu->getRunningExecuted() : 0);
+    rec.push_back(cpu->getQuantumCounter());
+    rec.push_back(cpu->getTimeSlice());
+    if (run && cpu->getType() == ProcType::LLF && run->hasDeadline())
+        rec.push_back(static_cast<const LLFProcessor *>(cpu)->runningLaxity());
+    else
+        rec.push_back(snaprec::NO_LAXITY);
+    rec.push_back(cpu->getBusy());
+    rec.push_back(cpu->getIdle());
+}
+
+template <typename Obs>
+Process *BasicScheduler<Obs>::findProcess(int pid) const
+{
+    for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+        if (n->data->getPID() == pid)
+            return n->data;
+    return nullptr;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::printProcess(const Process *p) const
+{
+    bool running = p->getState() == ProcState::RUN;
+    const Processor *cpu = (p->getCPU() >= 0) ? processors[p->getCPU()] : nullptr;
+
+    std::cout << "PID=" << p->getPID() << " " << Process::stateName(p->getState())
+              << " since t=" << p->getStateSince()
+              << " AT=" << p->getAT() << " CT=" << p->getCT()
+              << " rem=" << (running ? cpu->getRunningRemaining() : p->getRemaining());
+    if (cpu)
+        std::cout << " cpu=P" << cpu->getID() << " [" << procTypeName(cpu->getType()) << "]";
+    if (p->hasDeadline())
+        std::cout << " DL=" << p->getDeadline();
+    if (p->getTT() >= 0)
+        std::cout << " TT=" << p->getTT();
+    std::cout << "\n";
+
+    std::cout << "  IO: " << p->getNextIOIndex() << "/" << p->getIOCount() << " done";
+    if (p->getNextIORequestTime() >= 0)
+        std::cout << ", next at exec=" << p->getNextIORequestTime();
+    if (p->getPendingIO() > 0)
+        std::cout << ", pending=" << p->getPendingIO();
+    if (ioDev == p)
+        std::cout << ", on device (remainingIO=" << ioRemaining << ")";
+    std::cout << "\n";
+
+    std::cout << "  time (closed intervals): RDY=" << p->getRdyTime()
+              << " BLKW=" << p->getBlkWaitTime() << " IO=" << p->getIOTime()
+              << " RUN=" << p->getRunTime() << "\n";
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::resetBreakWatch()
+{
+    brkProc = (brk.pid >= 0) ? findProcess(brk.pid) : nullptr;
+    brkLastState = brkProc ? brkProc->getState() : ProcState::NEW;
+    brkRdyOver = false;
+    brkKills = killedCount;
+    brkMigrations = migRTF + migMaxW;
+    brkSteals = stealMoves;
+    brkForks = forkedCreated;
+    brkCreated = totalCreated;
+}
+
+// Checked after every tick while breakpoints are set; the watch state is
+// updated even when nothing fires, so each condition fires on a change.
+template <typename Obs>
+bool BasicScheduler<Obs>::breakHit(long long t, std::string &why)
+{
+    auto add = [&](const std::string &s)
+    {
+        if (!why.empty())
+            why += "; ";
+        why += s;
+    };
+
+    if (t == brk.at)
+        add("t=" + std::to_string(t));
+
+    if (brk.pid >= 0)
+    {
+        if (!brkProc && totalCreated != brkCreated)
+            brkProc = findProcess(brk.pid); // may be a new child or task job
+        if (brkProc)
+        {
+            ProcState s = brkProc->getState();
+            if (s == brk.state && brkLastState != s)
+                add("PID " + std::to_string(brk.pid) + " entered " + Process::stateName(s));
+            brkLastState = s;
+        }
+    }
+
+    if (brk.rdyOver >= 0)
+    {
+        int over = -1;
+        std::size_t n = 0;
+        for (int i = 0; i < totalProcs && over < 0; ++i)
+        {
+            n = visitCPU(processors[i], [](auto &cpu)
+                         { return cpu.readyCount(); });
+            if (n > (std::size_t)brk.rdyOver)
+                over = i;
+        }
+        if (over >= 0 && !brkRdyOver)
+            add("P" + std::to_string(over) + " RDY=" + std::to_string(n) + " > " + std::to_string(brk.rdyOver));
+        brkRdyOver = over >= 0;
+    }
+
+    if (brk.onKill && killedCount != brkKills)
+        add("kill");
+    if (brk.onMigrate && migRTF + migMaxW != brkMigrations)
+        add("migration");
+    if (brk.onSteal && stealMoves != brkSteals)
+        add("steal");
+    if (brk.onFork && forkedCreated != brkForks)
+        add("fork");
+    brkKills = killedCount;
+    brkMigrations = migRTF + migMaxW;
+    brkSteals = stealMoves;
+    brkForks = forkedCreated;
+    brkCreated = totalCreated;
+
+    return !why.empty();
+}
+
+template <typename Obs>
+bool BasicScheduler<Obs>::debugPrompt(long long t)
+{
+    std::string line;
+    while (true)
+    {
+        std::cout << "[t=" << t << "] s(tep) | c(ontinue) | p <pid> | cpu <id> | q(uit) > " << std::flush;
+        if (!std::getline(std::cin, line))
+            break; // no more input: finish like q
+
+        std::istringstream cmd(line);
+        std::string c;
+        cmd >> c;
+        if (c.empty() || c == "s")
+            return false;
+        if (c == "c")
+            return true;
+        if (c == "q")
+            break;
+
+        int id = -1;
+        if (c == "p" && cmd >> id)
+        {
+            if (Process *p = findProcess(id))
+                printProcess(p);
+            else
+                std::cout << "no process with PID " << id << "\n";
+        }
+        else if (c == "cpu" && cmd >> id)
+        {
+            if (id >= 0 && id < totalProcs)
+                printProcessor(id);
+            else
+                std::cout << "no processor " << id << "\n";
+        }
+        else
+            std::cout << "unknown command\n";
+    }
+
+    // run to the end without stopping again
+    brk = Breakpoints();
+    return true;
+}
+
+// ------------------ Phase2 core steps ------------------
+template <typename Obs>
+template <typename CPU>
+CPU *BasicScheduler<Obs>::pickShortest(FixedArray<CPU> &group, long long work)
+{
+    CPU *best = nullptr;
+    long long bestVal = LLONG_MAX;
+
+    for (CPU &cpu : group)
+    {
+        long long v = cpu.expectedFinishTime() + cpu.timeFor(work);
+        if (v < bestVal)
+        {
+            bestVal = v;
+            best = &cpu;
+        }
+    }
+    return best;
+}
+
+template <typename Obs>
+template <typename CPU>
+bool BasicScheduler<Obs>::tryMigrateOnDispatch([[maybe_unused]] const CPU &from, Process *p, [[maybe_unused]] long long t)
+{
+    if (!p)
+        return false;
+
+    // forked processes: no migration
+    if (p->isForkedChild())
+        return false;
+
+    // RR -> SJF if the time left on this CPU < RTF
+    if constexpr (isType<CPU, ProcType::RR>)
+    {
+        if (from.timeFor(p->getRemaining()) < in.RTF)
+        {
+            SJFProcessor *sjf = pickShortest(sjfCPUs, p->getRemaining());
+            if (sjf)
+            {
+                p->setState(ProcState::RDY, now());
+                sjf->enqueue(p);
+                p->setWaitCause(WaitCause::MIGRATION_RTF);
+                ++migRTF;
+                obs.onMigrate(p, from.getID(), sjf->getID(), t);
+                return true;
+            }
+        }
+    }
+
+    // FCFS -> RR if waitingSoFar > MaxW
+    if constexpr (isType<CPU, ProcType::FCFS>)
+    {
+        long long waitingSoFar = (t - p->getAT()) - p->getExecuted();
+        if (waitingSoFar > in.MaxW)
+        {
+            RRProcessor *rr = pickShortest(rrCPUs, p->getRemaining());
+            if (rr)
+            {
+                p->setState(ProcState::RDY, now());
+                rr->enqueue(p);
+                p->setWaitCause(WaitCause::MIGRATION_MAXW);
+                ++migMaxW;
+                obs.onMigrate(p, from.getID(), rr->getID(), t);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::dispatchIdleCPUs(long long t)
+{
+    // only idle CPUs with a non-empty RDY; migrations below may set bits
+    // further ahead, which the live scan still picks up
+    forEachGroup([&](auto &group)
+                 {
+        forEachSet(tracker.idleWithWork, group, [&](auto &cpu)
+        {
+            // a sleeping CPU first wakes up; its RDY waits meanwhile
+            if (cpu.isAsleep())
+                cpu.beginWake();
+            if (cpu.isWaking())
+                return;
+            long long woke = cpu.wakeDelay();
+
+            // Keep trying until we either run something or RDY becomes empty
+            while (cpu.isIdle())
+            {
+                Process *cand = cpu.popReady();
+                if (!cand)
+                    break;
+
+                // Migration check BEFORE RUN
+                if (tryMigrateOnDispatch(cpu, cand, t))
+                {
+                    // migrated somewhere else, try to get another cand for this CPU
+                    continue;
+                }
+
+                // Normal dispatch
+                if (woke > 0)
+                    cand->addWakeDelay((int)woke); // it waited out the whole wakeup
+                cand->setState(ProcState::RUN, now());
+                cand->markFirstRunIfNeeded(t, cpu.getID());
+                cpu.setRunning(cand);
+                cpu.resetQuantum(); // RR only (safe for all)
+                if constexpr (isType<decltype(cpu), ProcType::MLFQ>)
+                    cpu.setTimeSlice(cpu.quantumFor(cand)); // quantum of cand's level
+                if constexpr (isType<decltype(cpu), ProcType::CFS>)
+                    cpu.setTimeSlice(cpu.startRun(cand)); // weighted share of the target latency
+                obs.onDispatch(cand, cpu.getID(), t);
+                break;
+            }
+        }); });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::executeOneTick()
+{
+    // CPU tick over all running lanes at once; postCpuTransitions only
+    // visits CPUs flagged in the output masks. Idle CPUs cost nothing:
+    // busy/idle time is accounted on state switches.
+    TickMasks masks{tracker.finished.words(), tracker.ioDue.words(),
+                    tracker.quantumExpired.words(), tracker.transitions.words()};
+    tickKernel(tracker.lanes, tracker.running.words(), tracker.running.wordCount(), masks);
+    ++tracker.now;
+
+    // I/O device tick
+    if (ioDev)
+    {
+        --ioRemaining;
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::postCpuTransitions(long long t)
+{
+    forEachGroup([&](auto &group)
+                 {
+        forEachSet(tracker.transitions, group, [&](auto &cpu)
+        {
+            std::size_t id = (std::size_t)cpu.getID();
+            Process *run = cpu.getRunning();
+            if (!run)
+                return; // killed as an orphan earlier in this pass
+
+            // take run off the CPU (writes its progress back first)
+            auto release = [&]()
+            {
+                cpu.clearRunning();
+                cpu.resetQuantum();
+                if constexpr (isType<decltype(cpu), ProcType::CFS>)
+                    cpu.stopRun(run);
+            };
+
+            // finished
+            if (tracker.finished.test(id))
+            {
+                release();
+
+                // use unified termination (handles orphans + counters)
+                terminateProcess(run, t + 1, TermReason::NORMAL);
+
+                return;
+            }
+
+            // I/O due
+            if (tracker.ioDue.test(id))
+            {
+                release();
+                run->moveDueIOToPending();
+                run->setState(ProcState::BLK, now());
+                blkWait.enqueue(run);
+                obs.onBlock(run, cpu.getID(), t);
+                return;
+            }
+
+            // RR/MLFQ/CFS quantum expired => preempt (only their lanes have a slice)
+            if (tracker.quantumExpired.test(id))
+            {
+                release();
+                run->setState(ProcState::RDY, now());
+                if constexpr (isType<decltype(cpu), ProcType::MLFQ>)
+                    cpu.demote(run);
+                cpu.enqueue(run); // back to same ready queue
+                obs.onPreempt(run, cpu.getID(), t);
+            }
+        }); });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::finishIOIfDone(long long t)
+{
+    if (!ioDev)
+        return;
+    if (ioRemaining > 0)
+        return;
+
+    Process *done = ioDev;
+    ioDev = nullptr;
+    obs.onIOFinish(done, t);
+
+    done->setState(ProcState::RDY, now());
+    int idx = pickBestProcessorIndex(done->getRemaining());
+    visitCPU(processors[idx], [&](auto &cpu)
+             {
+                 cpu.enqueue(done);
+
+                 // EDF preemption check (if it went to EDF)
+                 if constexpr (isType<decltype(cpu), ProcType::EDF>)
+                     edfPreemptIfNeeded(cpu, t); });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::startIOIfPossible(long long t)
+{
+    if (ioDev)
+        return;
+    if (blkWait.empty())
+        return;
+
+    Process *p = nullptr;
+    if (!blkWait.dequeue(p))
+        return;
+
+    ioDev = p;
+    ioRemaining = ioDev->takePendingIO(); // duration from last due request
+    if (ioRemaining <= 0)
+    {
+        // safety: if something wrong, send it back RDY
+        ioDev->setState(ProcState::RDY, now());
+        int idx = pickBestProcessorIndex(ioDev->getRemaining());
+        visitCPU(processors[idx], [&](auto &cpu)
+                 { cpu.enqueue(ioDev); });
+        ioDev = nullptr;
+        ioRemaining = 0;
+        return;
+    }
+    ioDev->startIO(now());
+    obs.onIOStart(ioDev, ioRemaining, t);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::admitArrivals(long long t)
+{
+    // NEW and task jobs merged in (AT, PID) order, as if the jobs were
+    // process lines
+    while (true)
+    {
+        auto *head = in.newList.getHead();
+        bool fromNew = head && head->data->getAT() == t;
+        bool fromTask = taskJobs.nextAt() <= t;
+        if (!fromNew && !fromTask)
+            break;
+
+        Process *moved = nullptr;
+        if (fromNew && (!fromTask || head->data->getPID() < taskJobs.nextPid()))
+            in.newList.popFront(moved);
+        else
+        {
+            moved = taskJobs.release();
+            in.allProcesses.pushBack(moved);
+            ++totalCreated;
+        }
+        admitOne(moved, t);
+    }
+
+    while (!routed.empty() && routed.getHead()->data.at <= t)
+    {
+        RoutedArrival r{};
+        routed.popFront(r);
+        admitOne(r.p, t);
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::admitOne(Process *moved, long long t)
+{
+    moved->setState(ProcState::RDY, now());
+
+    if (dlPolicy == DeadlinePolicy::Firm && moved->hasDeadline())
+        armDeadline(moved, t, moved->getRemaining());
+
+    int idx = pickBestProcessorIndex(moved->getRemaining());
+    obs.onArrival(moved, idx, t);
+    visitCPU(processors[idx], [&](auto &cpu)
+             {
+                 cpu.enqueue(moved);
+
+                 // EDF preemption check (if this target processor is EDF)
+                 if constexpr (isType<decltype(cpu), ProcType::EDF>)
+                     edfPreemptIfNeeded(cpu, t); });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::inject(Process *p, long long at)
+{
+    in.allProcesses.pushBack(p);
+    routed.insertSorted(RoutedArrival{at, p}, [](const RoutedArrival &a, const RoutedArrival &b)
+                        { return a.at < b.at; });
+    ++totalCreated;
+    ++routedCount;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::injectKill(const KillEvent &k)
+{
+    routedKills.insertSorted(k, [](const KillEvent &a, const KillEvent &b)
+                             { return a.time < b.time; });
+}
+
+template <typename Obs>
+int BasicScheduler<Obs>::forkRoll()
+{
+    if (!forkSeeded)
+        return std::rand();
+    // 32-bit LCG (Numerical Recipes constants), upper bits
+    forkState = forkState * 1664525u + 1013904223u;
+    return (int)(forkState >> 8);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::reservePids(int maxPid)
+{
+    if (nextPid <= maxPid)
+        nextPid = maxPid + 1;
+}
+
+template <typename Obs>
+long long BasicScheduler<Obs>::bestFinishTime(long long work) const
+{
+    int i = pickBestProcessorIndex(work);
+    return processors[i]->expectedFinishTime() + processors[i]->timeFor(work);
+}
+
+template <typename Obs>
+RunTotals BasicScheduler<Obs>::totals() const
+{
+    RunTotals r;
+    for (Node<Process *> *n = trm.getHead(); n; n = n->next)
+    {
+        Process *p = n->data;
+        long long TRT = p->getTT() - p->getAT();
+        r.sumTRT += TRT;
+        r.sumWT += TRT - p->getCT();
+        r.sumRT += p->hasFirstRun() ? (p->getFirstRunTime() - p->getAT()) : 0;
+        ++r.count;
+        if (p->isFinished() && p->hasDeadline())
+        {
+            ++r.dlDone;
+            if (p->getTT() <= p->getDeadline())
+                ++r.dlMet;
+        }
+    }
+    for (int i = 0; i < totalProcs; ++i)
+    {
+        r.busy += processors[i]->getBusy();
+        r.idle += processors[i]->getIdle();
+    }
+    r.forked = forkedCreated;
+    r.killed = killedCount;
+    r.migRTF = migRTF;
+    r.migMaxW = migMaxW;
+    r.steals = stealMoves;
+    r.aborted = dlAborted;
+    r.ticks = tracker.now;
+    r.unterminated = unterminatedCount();
+    return r;
+}
+
+// ================= Simulation =================
+template <typename Obs>
+void BasicScheduler<Obs>::simulate(UIMode mode)
+{
+    run(mode);
+    warnIfUnterminated();
+
+    // ALWAYS write output in final project
+    writeOutputFile("data/output.txt");
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::simulateOnline(OnlineFeed &feed, std::ostream &stream)
+{
+    runOnline(feed, stream);
+    warnIfUnterminated();
+    writeOutputFile("data/output.txt");
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::run(UIMode mode)
+{
+    long long t = 0;
+
+    // with breakpoints, interactive / step runs go silently to the first
+    // one that fires and then prompt after every tick shown
+    const bool debugging = mode != UIMode::Silent && brk.armed();
+    bool fastForward = debugging;
+    if (debugging)
+        resetBreakWatch();
+
+    // plain interactive / step: rendering and pacing happen on a writer
+    // thread, the simulation only encodes and copies a record per tick
+    SnapshotWriter writer;
+    SnapshotCursor cursor;
+    if (mode != UIMode::Silent && !debugging)
+        writer.start(std::cout, mode == UIMode::Interactive ? SnapshotWriter::Pacing::Enter
+                                                            : SnapshotWriter::Pacing::OneSecond);
+
+    while (!isDone() && !pastHorizon(t))
+    {
+        step(t);
+
+        // 9) print
+        if (debugging)
+        {
+            std::string why;
+            bool hit = breakHit(t, why);
+            if (hit || !fastForward)
+            {
+                printSnapshot(t);
+                if (hit)
+                    std::cout << "*** Break: " << why << "\n";
+                fastForward = debugPrompt(t);
+            }
+        }
+        else if (writer.running())
+        {
+            encodeSnapshot(t, cursor, writer.record());
+            writer.push();
+        }
+
+        liveTick(t);
+        ++t;
+    }
+
+    if (live && t > 0)
+        publishLive(t - 1);
+
+    writer.finish();
+
+    // close the last (partial) window at the final tick
+    if (sampler && t > 0 && sampler->lastSampled() != t - 1)
+        takeSample(t - 1);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::runOnline(OnlineFeed &feed, std::ostream &stream)
+{
+    // PIDs still to come are unknown: keep forked children out of their way
+    reservePids(ONLINE_FORK_PIDS - 1);
+    stream << TRM_COLUMNS;
+    Node<Process *> *streamed = nullptr; // last TRM entry written
+    OnlineFeed::Item items[256];
+    long long t = 0;
+    while (!pastHorizon(t))
+    {
+        feed.waitForTick(t);
+
+        // read `closed` first: nothing arrives after the items drained below
+        bool closed = feed.inputClosed();
+        for (std::size_t n; (n = feed.read(items, 256)) > 0;)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // a line whose time already passed takes effect now
+                if (Process *p = items[i].proc)
+                {
+                    reservePids(p->getPID());
+                    inject(p, std::max(p->getAT(), t));
+                }
+                else
+                    injectKill(KillEvent{std::max(items[i].kill.time, t), items[i].kill.pid});
+            }
+        }
+        if (closed && isDone())
+            break;
+
+        step(t);
+
+        Node<Process *> *n = streamed ? streamed->next : trm.getHead();
+        for (; n; n = n->next)
+        {
+            writeTrmRow(stream, n->data);
+            streamed = n;
+        }
+        stream.flush();
+
+        liveTick(t);
+        ++t;
+    }
+    nextTick = t;
+
+    if (live && t > 0)
+        publishLive(t - 1);
+    if (sampler && t > 0 && sampler->lastSampled() != t - 1)
+        takeSample(t - 1);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::warnIfUnterminated() const
+{
+    if (!isDone())
+        std::cerr << "WARNING: horizon reached at t=" << tracker.now << " with "
+                  << unterminatedCount() << " of " << totalCreated
+                  << " processes not terminated; their statistics are missing\n";
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::runUntil(long long T)
+{
+    while (!isDone() && nextTick < T && !pastHorizon(nextTick))
+        step(nextTick++);
+}
+
+template <typename Obs>
+BasicScheduler<Obs> *BasicScheduler<Obs>::clone() const
+{
+    std::string err;
+    return branch(in, err);
+}
+
+template <typename Obs>
+BasicScheduler<Obs> *BasicScheduler<Obs>::branch(const SimConfig &cfg, std::string &err) const
+{
+    const int oldCount[PROC_TYPE_COUNT] = {in.NF, in.NS, in.NR, in.NE, in.NM, in.NC, in.NL};
+    const int newCount[PROC_TYPE_COUNT] = {cfg.NF, cfg.NS, cfg.NR, cfg.NE, cfg.NM, cfg.NC, cfg.NL};
+    bool grown = false;
+    for (int k = 0; k < PROC_TYPE_COUNT; ++k)
+    {
+        if (newCount[k] < oldCount[k])
+        {
+            err = std::string("cannot remove ") + procTypeName((ProcType)k) + " processors from a running simulation";
+            return nullptr;
+        }
+        grown = grown || newCount[k] > oldCount[k];
+    }
+    if (grown && !in.speeds.empty())
+    {
+        err = "cannot add processors when the input has a SPEED line";
+        return nullptr;
+    }
+    if (cfg.NM > 0 && in.mlfqLevels < 1)
+    {
+        err = "adding MLFQ processors needs the MLFQ config line in the input";
+        return nullptr;
+    }
+    if (cfg.NC > 0 && in.cfsLatency <= 0)
+    {
+        err = "adding CFS processors needs the CFS config line in the input";
+        return nullptr;
+    }
+    if (cfg.RTF < 0 || cfg.MaxW < 0 || cfg.STL < 0 || cfg.timeSlice < 0 || cfg.forkProb < 0 || cfg.forkProb > 100)
+    {
+        err = "RTF, MaxW, STL and the time slice must be >= 0, ForkProb 0..100";
+        return nullptr;
+    }
+
+    BasicScheduler *c = new BasicScheduler();
+    static_cast<SimConfig &>(c->in) = in;
+    c->in.M = in.M;
+    c->in.NF = cfg.NF;
+    c->in.NS = cfg.NS;
+    c->in.NR = cfg.NR;
+    c->in.NE = cfg.NE;
+    c->in.NM = cfg.NM;
+    c->in.NC = cfg.NC;
+    c->in.NL = cfg.NL;
+    c->in.timeSlice = cfg.timeSlice;
+    c->in.RTF = cfg.RTF;
+    c->in.MaxW = cfg.MaxW;
+    c->in.STL = cfg.STL;
+    c->in.forkProb = cfg.forkProb;
+    c->rdyKind = rdyKind;
+    c->dlPolicy = dlPolicy;
+    c->waitReport = waitReport;
+    c->forkSeeded = forkSeeded;
+    c->forkState = forkState;
+    c->buildProcessors();
+    c->tracker.now = tracker.now;
+
+    // processor IDs: every type keeps its order and shifts by the
+    // processors added to the types before it
+    std::vector<int> cpuID(totalProcs);
+    for (int k = 0, from = 0, to = 0; k < PROC_TYPE_COUNT; from += oldCount[k], to += newCount[k], ++k)
+        for (int i = 0; i < oldCount[k]; ++i)
+            cpuID[from + i] = to + i;
+
+    std::unordered_map<const Process *, Process *> copies;
+    copies.reserve(in.allProcesses.size());
+    for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+        copies[n->data] = Process::copyOf(*n->data, cpuID.data());
+    auto map = [&](const Process *p) -> Process *
+    { return p ? copies.find(p)->second : nullptr; };
+
+    for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+    {
+        Process *q = map(n->data);
+        q->setParent(map(n->data->getParent()));
+        for (Node<Process *> *ch = n->data->getChildren().getHead(); ch; ch = ch->next)
+            q->addChild(map(ch->data));
+    }
+    c->in.allProcesses.copyFrom(in.allProcesses, map);
+    c->in.newList.copyFrom(in.newList, map);
+    c->in.killEvents.copyFrom(in.killEvents, [](const KillEvent &k)
+                              { return k; });
+    c->killCur = nullptr;
+    for (Node<KillEvent> *a = in.killEvents.getHead(), *b = c->in.killEvents.getHead(); a; a = a->next, b = b->next)
+        if (a == killCur)
+            c->killCur = b;
+
+    auto copyGroup = [&](auto &to, const auto &from)
+    {
+        for (std::size_t i = 0; i < from.size(); ++i)
+            to[i].copyFrom(from[i], map);
+        for (std::size_t i = from.size(); i < to.size(); ++i)
+            to[i].startIdleAt(tracker.now);
+    };
+    copyGroup(c->fcfsCPUs, fcfsCPUs);
+    copyGroup(c->sjfCPUs, sjfCPUs);
+    copyGroup(c->rrCPUs, rrCPUs);
+    copyGroup(c->edfCPUs, edfCPUs);
+    copyGroup(c->mlfqCPUs, mlfqCPUs);
+    copyGroup(c->cfsCPUs, cfsCPUs);
+    copyGroup(c->llfCPUs, llfCPUs);
+    // MLFQ / CFS set their slice per dispatch, RR's is the config's
+    for (RRProcessor &rr : c->rrCPUs)
+        rr.setTimeSlice(cfg.timeSlice);
+
+    c->blkWait.copyFrom(blkWait, map);
+    c->ioDev = map(ioDev);
+    c->ioRemaining = ioRemaining;
+    c->trm.copyFrom(trm, map);
+    c->trmCount = trmCount;
+    c->nextPid = nextPid;
+    c->totalCreated = totalCreated;
+    c->migRTF = migRTF;
+    c->migMaxW = migMaxW;
+    c->stealMoves = stealMoves;
+    c->forkedCreated = forkedCreated;
+    c->killedCount = killedCount;
+    c->routed.copyFrom(routed, [&](const RoutedArrival &r)
+                       { return RoutedArrival{r.at, map(r.p)}; });
+    c->routedCount = routedCount;
+    c->routedKills.copyFrom(routedKills, [](const KillEvent &k)
+                            { return k; });
+    c->taskJobs.copyFrom(taskJobs, c->in.tasks);
+    c->nextTick = nextTick;
+    c->horizon = horizon;
+    c->dlWheel.copyFrom(dlWheel, map);
+    c->dlAborted = dlAborted;
+    c->dlSavedCPU = dlSavedCPU;
+    return c;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::step(long long t)
+{
+    // 1) arrivals
+    admitArrivals(t);
+
+    // 2) SIGKILL at time t, then firm-deadline aborts
+    applySigKill(t);
+    expireDeadlines(t);
+
+    // 3) work stealing + MLFQ priority boost + LLF laxity preemption
+    workStealIfNeeded(t);
+    boostMLFQIfDue(t);
+    llfPreemptIfNeeded(t);
+
+    // 4) dispatch (includes migration checks)
+    dispatchIdleCPUs(t);
+
+    // 5) fork (FCFS RUN only)
+    attemptForking(t);
+
+    // 6) execute 1 tick (CPU + IO device)
+    executeOneTick();
+
+    // 7) transitions (finish / IO due / RR+MLFQ+CFS preempt)
+    postCpuTransitions(t);
+
+    // 8) IO finish/start
+    finishIOIfDone(t);
+    startIOIfPossible(t);
+
+    if (sampler && sampler->due(t))
+        takeSample(t);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::takeSample(long long t)
+{
+    std::int64_t *f = sampler->frame();
+    f[Sampler::F_T] = t;
+    f[Sampler::F_COMPLETIONS] = trmCount;
+    f[Sampler::F_STEALS] = stealMoves;
+    f[Sampler::F_BLK] = (std::int64_t)blkWait.size();
+    f[Sampler::F_IO_PID] = ioDev ? ioDev->getPID() : -1;
+    f[Sampler::F_IO_REMAINING] = ioDev ? ioRemaining : 0;
+
+    std::int64_t *c = f + Sampler::ROW_FIELDS;
+    for (int i = 0; i < totalProcs; ++i, c += Sampler::CPU_FIELDS)
+    {
+        c[0] = (std::int64_t)visitCPU(processors[i], [](auto &cpu)
+                                      { return cpu.readyCount(); });
+        c[1] = processors[i]->expectedFinishTime();
+        Process *run = processors[i]->getRunning();
+        c[2] = run ? run->getPID() : -1;
+    }
+    sampler->commit();
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::liveTick(long long t)
+{
+    if (!live)
+        return;
+    if (live->due(t))
+        publishLive(t);
+    if (LiveStats::takeSnapshotRequest())
+        writeSnapshotFile(t);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::publishLive(long long t)
+{
+    LiveBlock *b = live->beginUpdate();
+    b->terminated = trmCount;
+    b->total = totalCreated;
+    b->migRTF = migRTF;
+    b->migMaxW = migMaxW;
+    b->steals = stealMoves;
+    b->forks = forkedCreated;
+    b->kills = killedCount;
+    b->aborted = dlAborted;
+    for (int i = 0; i < totalProcs; ++i)
+    {
+        LiveCpu *c = live->cpu(i);
+        Process *run = processors[i]->getRunning();
+        c->type = (std::int32_t)processors[i]->getType();
+        c->runPid = run ? run->getPID() : -1;
+        c->ready = (std::int64_t)visitCPU(processors[i], [](auto &cpu)
+                                          { return cpu.readyCount(); });
+        c->busy = processors[i]->getBusy();
+        c->idle = processors[i]->getIdle();
+    }
+    live->endUpdate(t);
+}
+
+// SIGUSR1: the snapshot view at the end of tick t, written between two ticks
+template <typename Obs>
+void BasicScheduler<Obs>::writeSnapshotFile(long long t) const
+{
+    std::ofstream out(live->snapshotPath(t));
+    if (!out)
+        return;
+    printSnapshot(t, out);
+    out << "Terminated: " << trmCount << "/" << totalCreated
+        << " Migrations: " << migRTF << "+" << migMaxW << " Steals: " << stealMoves
+        << " Forks: " << forkedCreated << " Kills: " << killedCount << "\n";
+}
+
+// A job at tick t with r units of work left finishes at t + T(r) at the
+// earliest, T being the time on the fastest processor, so it is hopeless
+// from tick DL - T(r) + 1 on. Running never moves that bound earlier;
+// waiting, I/O and being preempted move it closer. The timer fires at the
+// bound as of arming and is re-armed if the job ran in between.
+template <typename Obs>
+long long BasicScheduler<Obs>::fastestTimeFor(long long work) const
+{
+    return (maxSpeed == SPEED_ONE) ? work : ((work << SPEED_SHIFT) + maxSpeed - 1) / maxSpeed;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::armDeadline(Process *p, long long t, int remaining)
+{
+    long long at = (long long)p->getDeadline() - fastestTimeFor(remaining) + 1;
+    dlWheel.schedule(at < t ? t : at, p);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::expireDeadlines(long long t)
+{
+    if (dlWheel.empty())
+        return;
+
+    LinkedList<Process *> due;
+    dlWheel.advance(t, due);
+
+    Process *p = nullptr;
+    while (due.popFront(p))
+    {
+        if (p->getState() == ProcState::TRM)
+            continue; // finished or killed since arming
+
+        int rem = p->getRemaining();
+        if (p->getState() == ProcState::RUN)
+            rem = processors[p->getCPU()]->getRunningRemaining();
+
+        if ((long long)t + fastestTimeFor(rem) <= p->getDeadline())
+            armDeadline(p, t, rem);
+        else
+            abortForDeadline(p, t);
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::abortForDeadline(Process *p, long long t)
+{
+    switch (p->getState())
+    {
+    case ProcState::RUN:
+        visitCPU(processors[p->getCPU()], [&](auto &cpu)
+                 {
+                     cpu.clearRunning();
+                     cpu.resetQuantum();
+                     if constexpr (isType<decltype(cpu), ProcType::CFS>)
+                         cpu.stopRun(p); });
+        break;
+    case ProcState::RDY:
+        visitCPU(processors[p->getCPU()], [&](auto &cpu)
+                 { cpu.removeReady(p); });
+        break;
+    case ProcState::BLK:
+        if (ioDev == p)
+        {
+            ioDev = nullptr;
+            ioRemaining = 0;
+        }
+        else
+            blkWait.remove(p);
+        break;
+    default:
+        break;
+    }
+
+    ++dlAborted;
+    dlSavedCPU += p->getRemaining();
+    terminateProcess(p, t, TermReason::DEADLINE_MISS);
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::boostMLFQIfDue(long long t)
+{
+    if (in.mlfqBoost <= 0 || t == 0 || t % in.mlfqBoost != 0)
+        return;
+    for (MLFQProcessor &cpu : mlfqCPUs)
+        cpu.boost();
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::llfPreemptIfNeeded(long long t)
+{
+    // RDY laxities shrink every tick while RUN's stays put, so re-check each tick
+    forEachSet(tracker.running, llfCPUs, [&](LLFProcessor &cpu)
+    {
+        if (cpu.shouldPreempt())
+        {
+            preemptRunning(cpu, t);
+            cpu.notePreemption();
+        }
+    });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::terminateProcess(Process *p, long long tt, TermReason why)
+{
+    if (!p)
+        return;
+
+    // set termination
+    p->setState(ProcState::TRM, tt);
+    p->setTT(tt);
+
+    // if killed before first run -> set RT consistently
+    p->markFirstRunIfNeeded(tt);
+
+    // counts
+    ++trmCount;
+    if (why == TermReason::SIGKILL || why == TermReason::ORPHAN)
+    {
+        ++killedCount;
+    }
+
+    // add to TRM list
+    trm.pushBack(p);
+    obs.onTerminate(p, why, tt);
+
+    // kill descendants immediately (orphans)
+    LinkedList<Process *> &kids = p->getChildren();
+    Node<Process *> *c = kids.getHead();
+    while (c)
+    {
+        Process *child = c->data;
+        // child is forked => guaranteed to be in FCFS RUN/RDY (no IO, no migration/steal)
+        killByPIDinFCFS(child->getPID(), tt, TermReason::ORPHAN);
+        c = c->next;
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::initNextPid()
+{
+    int mx = 0;
+    Node<Process *> *n = in.allProcesses.getHead();
+    while (n)
+    {
+        int pid = n->data->getPID();
+        if (pid > mx)
+            mx = pid;
+        n = n->next;
+    }
+    mx = std::max(mx, TaskGenerator::maxPid(in.tasks));
+    nextPid = mx + 1;
+}
+
+template <typename Obs>
+bool BasicScheduler<Obs>::killByPIDinFCFS(int pid, long long tt, TermReason why)
+{
+    for (FCFSProcessor &fcfs : fcfsCPUs)
+    {
+        // 1) RUN?
+        Process *run = fcfs.getRunning();
+        if (run && run->getPID() == pid)
+        {
+            fcfs.clearRunning();
+            obs.onKill(run, why, tt);
+            terminateProcess(run, tt, why);
+            return true;
+        }
+
+        // 2) RDY?
+        Process *removed = nullptr;
+        if (fcfs.removeReadyByPID(pid, removed))
+        {
+            obs.onKill(removed, why, tt);
+            terminateProcess(removed, tt, why);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::applySigKill(long long t)
+{
+    while (killCur && killCur->data.time == t)
+    {
+        int pid = killCur->data.pid;
+        killByPIDinFCFS(pid, t, TermReason::SIGKILL);
+        killCur = killCur->next;
+    }
+    KillEvent k;
+    while (!routedKills.empty() && routedKills.getHead()->data.time <= t)
+    {
+        routedKills.popFront(k);
+        killByPIDinFCFS(k.pid, t, TermReason::SIGKILL);
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::attemptForking(long long t)
+{
+    if (in.forkProb <= 0)
+        return;
+
+    // running FCFS CPUs only
+    forEachSet(tracker.running, fcfsCPUs, [&](FCFSProcessor &cpu)
+    {
+        Process *parent = cpu.getRunning();
+
+        // optional: do not allow forked children to fork
+        if (parent->isForkedChild())
+            return;
+
+        if (parent->hasForkedOnce())
+            return;
+
+        int r = (forkRoll() % 100) + 1; // 1..100
+        if (r > in.forkProb)
+            return;
+
+        // child: AT=t, CTchild = remaining of parent, no IO at all
+        Process *child = new Process(nextPid++, t, cpu.getRunningRemaining(), 0, nullptr);
+        child->setState(ProcState::RDY, now());
+        child->setForkedChild(true);
+        child->setParent(parent);
+        parent->addChild(child);
+        parent->markForkedOnce();
+
+        // ownership for cleanup
+        in.allProcesses.pushBack(child);
+
+        ++forkedCreated;
+        ++totalCreated;
+        obs.onFork(parent, child, t);
+
+        // enqueue to shortest FCFS processor (the forking one is FCFS, so never null)
+        pickShortest(fcfsCPUs, child->getRemaining())->enqueue(child);
+    });
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::workStealIfNeeded(long long t)
+{
+    if (in.STL <= 0)
+        return;
+    if (t == 0)
+        return;
+    if (t % in.STL != 0)
+        return;
+
+    while (true)
+    {
+        int longIdx = findLongestByEFT();
+        int shortIdx = findShortestByEFT();
+
+        if (longIdx < 0 || shortIdx < 0)
+            return;
+        if (longIdx == shortIdx)
+            return;
+
+        long long LQF = processors[longIdx]->expectedFinishTime();
+        long long SQF = processors[shortIdx]->expectedFinishTime();
+        if (LQF <= 0)
+            return;
+
+        double stealLimit = (double)(LQF - SQF) * 100.0 / (double)LQF;
+        if (stealLimit <= 40.0)
+            return;
+
+        // must steal TOP of longest ready queue
+        Process *top = visitCPU(processors[longIdx], [](auto &cpu)
+                                { return cpu.peekReady(); });
+        if (!top)
+            return;
+
+        // forked processes: cannot be stolen
+        if (top->isForkedChild())
+            return;
+
+        // the move must leave the receiver below where the donor was
+        // (in time on the receiver's speed); otherwise the top would just
+        // bounce between the two
+        if (SQF + processors[shortIdx]->timeFor(top->getRemaining()) >= LQF)
+            return;
+
+        Process *stolen = visitCPU(processors[longIdx], [](auto &cpu)
+                                   { return cpu.popReady(); });
+        if (!stolen)
+            return;
+
+        stolen->setWaitCause(WaitCause::STOLEN_LATE); // charges the wait on the donor
+        stolen->setState(ProcState::RDY, now());
+        visitCPU(processors[shortIdx], [&](auto &cpu)
+                 { cpu.enqueue(stolen); });
+        ++stealMoves;
+        obs.onSteal(stolen, longIdx, shortIdx, t);
+    }
+}
+
+template <typename Obs>
+int BasicScheduler<Obs>::findLongestByEFT() const
+{
+    int best = -1;
+    long long bestVal = -1;
+
+    for (int i = 0; i < totalProcs; ++i)
+    {
+        std::size_t rc = visitCPU(processors[i], [](auto &cpu)
+                                  { return cpu.readyCount(); });
+        if (rc == 0)
+            continue; // must steal from RDY
+        long long v = processors[i]->expectedFinishTime();
+        if (v > bestVal)
+        {
+            bestVal = v;
+            best = i;
+        }
+    }
+    return best;
+}
+
+template <typename Obs>
+int BasicScheduler<Obs>::findShortestByEFT() const
+{
+    int best = -1;
+    long long bestVal = LLONG_MAX;
+
+    for (int i = 0; i < totalProcs; ++i)
+    {
+        long long v = processors[i]->expectedFinishTime();
+        if (v < bestVal)
+        {
+            bestVal = v;
+            best = i;
+        }
+    }
+    return best;
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::writeTrmRow(std::ostream &out, const Process *p)
+{
+    long long AT = p->getAT();
+    long long TRT = p->getTT() - AT;
+    out << p->getTT() << " " << p->getPID() << " " << AT << " " << p->getCT() << " "
+        << (p->hasDeadline() ? p->getDeadline() : -1) << " " << p->getTotalIODur() << " "
+        << TRT - p->getCT() << " " << (p->hasFirstRun() ? p->getFirstRunTime() - AT : 0) << " " << TRT << " "
+        << p->getRdyTime() << " " << p->getBlkWaitTime() << " " << p->getIOTime() << " " << p->getRunTime() << "\n";
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::writeOutputFile(const std::string &path) const
+{
+    std::ofstream out(path);
+    if (!out)
+        return;
+
+    // add DL column
+    // RDY/BLKW/IO/RUN: time spent in each state (BLKW = queued for the IO device)
+    out << TRM_COLUMNS;
+
+    long long sumWT = 0, sumRT = 0, sumTRT = 0;
+    int count = 0;
+
+    int completedWithDL = 0;
+    int metDL = 0;
+
+    // RT/TRT grouped by the type of the processor a process first ran on
+    long long typeRT[PROC_TYPE_COUNT] = {}, typeTRT[PROC_TYPE_COUNT] = {};
+    int typeCount[PROC_TYPE_COUNT] = {};
+    int typeDLDone[PROC_TYPE_COUNT] = {}, typeDLMet[PROC_TYPE_COUNT] = {};
+
+    // residency sums: RDY, BLKW, IO, RUN
+    long long sumRes[4] = {};
+    long long typeRes[PROC_TYPE_COUNT][4] = {};
+
+    long long sumWake = 0, sumWakeRT = 0;
+    int wakeDelayed = 0;
+
+    Node<Process *> *n = trm.getHead();
+    while (n)
+    {
+        Process *p = n->data;
+
+        long long TT = p->getTT();
+        long long AT = p->getAT();
+        int CT = p->getCT();
+        long long DL = p->hasDeadline() ? p->getDeadline() : -1;
+
+        long long TRT = TT - AT;
+        long long WT = TRT - CT; // if you want: WT = TRT - CT - IO_D (depending on your rubric)
+        long long RT = p->hasFirstRun() ? (p->getFirstRunTime() - AT) : 0;
+
+        const long long res[4] = {p->getRdyTime(), p->getBlkWaitTime(), p->getIOTime(), p->getRunTime()};
+
+        writeTrmRow(out, p);
+
+        sumWT += WT;
+        sumRT += RT;
+        sumTRT += TRT;
+        ++count;
+        for (int k = 0; k < 4; ++k)
+            sumRes[k] += res[k];
+
+        sumWake += p->getWakeDelay();
+        sumWakeRT += p->getWakeDelayRT();
+        if (p->getWakeDelay() > 0)
+            ++wakeDelayed;
+
+        if (p->getFirstRunCPU() >= 0)
+        {
+            int tp = (int)processors[p->getFirstRunCPU()]->getType();
+            typeRT[tp] += RT;
+            typeTRT[tp] += TRT;
+            ++typeCount[tp];
+            for (int k = 0; k < 4; ++k)
+                typeRes[tp][k] += res[k];
+        }
+
+        // deadline metric: only for completed processes with deadlines
+        if (p->isFinished() && p->hasDeadline())
+        {
+            ++completedWithDL;
+            if (TT <= DL)
+                ++metDL;
+            if (p->getFirstRunCPU() >= 0)
+            {
+                int tp = (int)processors[p->getFirstRunCPU()]->getType();
+                ++typeDLDone[tp];
+                if (TT <= DL)
+                    ++typeDLMet[tp];
+            }
+        }
+
+        n = n->next;
+    }
+
+    out << "\n--- Summary ---\n";
+    out << "Total Processes: " << count << "\n";
+    out << "Forked Created: " << forkedCreated << "\n";
+    out << "Killed (SIGKILL+ORPHAN): " << killedCount << "\n";
+    out << "Migration RTF (RR->SJF): " << migRTF << "\n";
+    out << "Migration MaxW (FCFS->RR): " << migMaxW << "\n";
+    out << "Steal Moves: " << stealMoves << "\n";
+    if (!isDone())
+        out << "WARNING: stopped at horizon t=" << tracker.now << ", "
+            << unterminatedCount() << " processes not terminated (not counted below)\n";
+
+    if (count > 0)
+    {
+        out << "Avg WT: " << (double)sumWT / count << "\n";
+        out << "Avg RT: " << (double)sumRT / count << "\n";
+        out << "Avg TRT: " << (double)sumTRT / count << "\n";
+        out << "Avg RDY: " << (double)sumRes[0] / count
+            << " BLKW: " << (double)sumRes[1] / count
+            << " IO: " << (double)sumRes[2] / count
+            << " RUN: " << (double)sumRes[3] / count << "\n";
+    }
+
+    // Deadline metric
+    if (completedWithDL > 0)
+    {
+        double pct = 100.0 * metDL / completedWithDL;
+        out << "Completed before deadline: " << pct
+            << "% (" << metDL << "/" << completedWithDL << ")\n";
+    }
+    else
+    {
+        out << "Completed before deadline: N/A (no deadlines)\n";
+    }
+    if (in.NL > 0)
+    {
+        // deadline-driven types side by side, by first processor type
+        const ProcType dlTypes[] = {ProcType::EDF, ProcType::LLF};
+        for (ProcType tp : dlTypes)
+        {
+            int done = typeDLDone[(int)tp];
+            out << "  " << procTypeName(tp) << ": ";
+            if (done > 0)
+                out << 100.0 * typeDLMet[(int)tp] / done << "% (" << typeDLMet[(int)tp] << "/" << done << ")\n";
+            else
+                out << "N/A\n";
+        }
+    }
+    if (dlPolicy == DeadlinePolicy::Firm)
+    {
+        out << "Deadline policy: firm\n";
+        out << "Aborted (deadline miss): " << dlAborted << "\n";
+        out << "CPU time saved by aborts: " << dlSavedCPU << "\n";
+    }
+
+    out << "\n--- By First Processor Type ---\n";
+    for (int tp = 0; tp < PROC_TYPE_COUNT; ++tp)
+    {
+        if (typeCount[tp] == 0)
+            continue;
+        out << procTypeName((ProcType)tp) << ": n=" << typeCount[tp]
+            << " Avg RT=" << (double)typeRT[tp] / typeCount[tp]
+            << " Avg TRT=" << (double)typeTRT[tp] / typeCount[tp]
+            << " RDY=" << (double)typeRes[tp][0] / typeCount[tp]
+            << " BLKW=" << (double)typeRes[tp][1] / typeCount[tp]
+            << " IO=" << (double)typeRes[tp][2] / typeCount[tp]
+            << " RUN=" << (double)typeRes[tp][3] / typeCount[tp] << "\n";
+    }
+
+    // energy per processor: busy and waking at busy power, the rest of idle
+    // split into awake idle and sleep
+    auto energyOf = [&](int i, double parts[4])
+    {
+        int tp = (int)processors[i]->getType();
+        long long sleep = processors[i]->getSleep();
+        long long waking = processors[i]->getWaking();
+        long long awake = processors[i]->getIdle() - sleep - waking;
+        parts[0] = processors[i]->getBusy() * in.powerBusy[tp];
+        parts[1] = awake * in.powerIdle[tp];
+        parts[2] = sleep * in.powerSleep[tp];
+        parts[3] = waking * in.powerBusy[tp];
+        return parts[0] + parts[1] + parts[2] + parts[3];
+    };
+
+    if (in.powerEnabled)
+    {
+        double sum[4] = {};
+        long long wakeups = 0;
+        for (int i = 0; i < totalProcs; ++i)
+        {
+            double parts[4];
+            energyOf(i, parts);
+            for (int k = 0; k < 4; ++k)
+                sum[k] += parts[k];
+            wakeups += processors[i]->getWakeups();
+        }
+        double total = sum[0] + sum[1] + sum[2] + sum[3];
+
+        out << "\n--- Power ---\n";
+        out << "Idle threshold: " << in.idleThreshold << " Wakeup latency: " << in.wakeLatency << "\n";
+        out << "Energy: " << total << " (busy=" << sum[0] << " idle=" << sum[1]
+            << " sleep=" << sum[2] << " wake=" << sum[3] << ")\n";
+        if (tracker.now > 0)
+            out << "Avg power: " << total / tracker.now << "\n";
+        out << "Wakeups: " << wakeups << " (processes delayed: " << wakeDelayed
+            << ", delay ticks: " << sumWake << ")\n";
+        if (count > 0)
+        {
+            out << "Avg RT: " << (double)sumRT / count
+                << " (wakeup share: " << (double)sumWakeRT / count << ")\n";
+            out << "Avg TRT: " << (double)sumTRT / count
+                << " (wakeup share: " << (double)sumWake / count << ")\n";
+        }
+    }
+
+    out << "\n--- Processor Stats ---\n";
+    for (int i = 0; i < totalProcs; ++i)
+    {
+        long long busy = processors[i]->getBusy();
+        long long idle = processors[i]->getIdle();
+        long long total = busy + idle;
+        double util = (total > 0) ? (100.0 * busy / total) : 0.0;
+
+        const char *typeStr = procTypeName(processors[i]->getType());
+
+        out << "P" << processors[i]->getID() << " [" << typeStr << "] "
+            << "busy=" << busy << " idle=" << idle << " util%=" << util;
+        if (processors[i]->getType() == ProcType::MLFQ)
+        {
+            const MLFQProcessor *m = static_cast<const MLFQProcessor *>(processors[i]);
+            out << " levels=" << m->getLevels()
+                << " demotions=" << m->getDemotions() << " boosts=" << m->getBoosts();
+        }
+        else if (processors[i]->getType() == ProcType::CFS)
+        {
+            const CFSProcessor *c = static_cast<const CFSProcessor *>(processors[i]);
+            out << " dispatches=" << c->getDispatches()
+                << " avgSlice=" << c->getAvgSlice()
+                << " avgWait=" << c->getAvgWait() << " maxWait=" << c->getMaxWait()
+                << " maxVrtSpread=" << c->getMaxSpread();
+        }
+        else if (processors[i]->getType() == ProcType::LLF)
+        {
+            const LLFProcessor *l = static_cast<const LLFProcessor *>(processors[i]);
+            out << " hysteresis=" << l->getHysteresis() << " preemptions=" << l->getPreemptions();
+        }
+        if (!in.speeds.empty())
+            out << " speed=" << (double)processors[i]->getSpeed() / SPEED_ONE;
+        if (in.powerEnabled)
+        {
+            double parts[4];
+            out << " sleep=" << processors[i]->getSleep()
+                << " wakeups=" << processors[i]->getWakeups()
+                << " energy=" << energyOf(i, parts);
+        }
+        out << "\n";
+    }
+
+    if (waitReport)
+        writeWaitReport(out);
+}
+
+// Where the slowest 1% (by TRT) of the terminated processes waited: the
+// group's waiting ticks by cause, then the top causes of the slowest ones.
+template <typename Obs>
+void BasicScheduler<Obs>::writeWaitReport(std::ostream &out) const
+{
+    std::vector<const Process *> procs;
+    for (Node<Process *> *n = trm.getHead(); n; n = n->next)
+        procs.push_back(n->data);
+    if (procs.empty())
+        return;
+
+    auto trtOf = [](const Process *p)
+    { return p->getTT() - p->getAT(); };
+    std::sort(procs.begin(), procs.end(), [&](const Process *a, const Process *b)
+              { return trtOf(a) != trtOf(b) ? trtOf(a) > trtOf(b) : a->getPID() < b->getPID(); });
+
+    std::size_t tail = (procs.size() + 99) / 100;
+    long long byCause[WAIT_CAUSE_COUNT] = {};
+    long long waited = 0, trt = 0;
+    for (std::size_t i = 0; i < tail; ++i)
+    {
+        for (int c = 0; c < WAIT_CAUSE_COUNT; ++c)
+            byCause[c] += procs[i]->getWaitTime((WaitCause)c);
+        trt += trtOf(procs[i]);
+    }
+    for (long long w : byCause)
+        waited += w;
+
+    // causes by descending share (ties: enum order)
+    auto ranked = [](const long long *w, int order[WAIT_CAUSE_COUNT])
+    {
+        for (int c = 0; c < WAIT_CAUSE_COUNT; ++c)
+            order[c] = c;
+        std::stable_sort(order, order + WAIT_CAUSE_COUNT, [&](int a, int b)
+                         { return w[a] > w[b]; });
+    };
+
+    out << "\n--- Tail Wait Causes (slowest 1%) ---\n";
+    out << "Processes: " << tail << " of " << procs.size()
+        << " (TRT >= " << trtOf(procs[tail - 1]) << ")\n";
+    out << "Waiting: " << waited << " of " << trt << " TRT ticks";
+    if (trt > 0)
+        out << " (" << 100.0 * waited / trt << "%)";
+    out << "\n";
+
+    int order[WAIT_CAUSE_COUNT];
+    ranked(byCause, order);
+    for (int c : order)
+    {
+        if (byCause[c] == 0)
+            break;
+        out << "  " << Process::waitCauseName((WaitCause)c) << ": " << byCause[c]
+            << " (" << 100.0 * byCause[c] / waited << "%)\n";
+    }
+
+    const std::size_t shown = tail < 10 ? tail : 10;
+    out << "Slowest:\n";
+    for (std::size_t i = 0; i < shown; ++i)
+    {
+        const Process *p = procs[i];
+        long long w[WAIT_CAUSE_COUNT];
+        for (int c = 0; c < WAIT_CAUSE_COUNT; ++c)
+            w[c] = p->getWaitTime((WaitCause)c);
+        ranked(w, order);
+
+        out << "  PID " << p->getPID() << " TRT=" << trtOf(p) << ":";
+        for (int k = 0; k < 3 && w[order[k]] > 0; ++k)
+            out << (k ? ", " : " ") << Process::waitCauseName((WaitCause)order[k]) << " " << w[order[k]];
+        out << "\n";
+    }
+}
+
+template <typename Obs>
+void BasicScheduler<Obs>::edfPreemptIfNeeded(EDFProcessor &cpu, long long t)
+{
+    Process *run = cpu.getRunning();
+    Process *top = cpu.peekReady();
+    if (!run || !top)
+        return;
+
+    long long dr = run->hasDeadline() ? run->getDeadline() : LLONG_MAX;
+    long long dt = top->hasDeadline() ? top->getDeadline() : LLONG_MAX;
+
+    if (dt < dr)
+        preemptRunning(cpu, t);
+}
+
+template <typename Obs>
+template <typename CPU>
+void BasicScheduler<Obs>::preemptRunning(CPU &cpu, long long t)
+{
+    Process *run = cpu.getRunning();
+
+    // clear first: it writes remaining back before enqueue
+    cpu.clearRunning();
+    cpu.resetQuantum();
+    run->setState(ProcState::RDY, now());
+    cpu.enqueue(run);
+    if constexpr (isType<CPU, ProcType::EDF>)
+        run->setWaitCause(WaitCause::EDF_PREEMPT);
+    if constexpr (isType<CPU, ProcType::LLF>)
+        run->setWaitCause(WaitCause::LLF_PREEMPT);
+    obs.onPreempt(run, cpu.getID(), t);
+
+    Process *next = cpu.popReady();
+    if (next)
+    {
+        next->setState(ProcState::RUN, now());
+        next->markFirstRunIfNeeded(t, cpu.getID());
+        cpu.setRunning(next);
+        obs.onDispatch(next, cpu.getID(), t);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+class Process;
+
+enum class TermReason
+{
+    NORMAL,
+    SIGKILL,
+    ORPHAN,
+    DEADLINE_MISS
+};
+
+// Scheduling events of BasicScheduler<Observer>. The scheduler calls these
+// on its observer object at the point the event happens (after its own
+// state is updated); `cpu` / `from` / `to` are global processor indices and
+// `t` the tick it happens in. NullObserver's callbacks are empty inline
+// functions, so the default Scheduler compiles them away. Derive from
+// NullObserver and hide the callbacks of interest (no virtuals involved).
+struct NullObserver
+{
+    void onArrival(const Process *, int /*cpu*/, long long /*t*/) {}
+    void onDispatch(const Process *, int /*cpu*/, long long /*t*/) {}
+    void onPreempt(const Process *, int /*cpu*/, long long /*t*/) {} // back to the same RDY
+    void onBlock(const Process *, int /*cpu*/, long long /*t*/) {}   // left the CPU for BLK
+    void onIOStart(const Process *, int /*duration*/, long long /*t*/) {}
+    void onIOFinish(const Process *, long long /*t*/) {}
+    void onMigrate(const Process *, int /*from*/, int /*to*/, long long /*t*/) {} // RTF / MaxW
+    void onSteal(const Process *, int /*from*/, int /*to*/, long long /*t*/) {}
+    void onFork(const Process * /*parent*/, const Process * /*child*/, long long /*t*/) {}
+    void onKill(const Process *, TermReason /*SIGKILL or ORPHAN*/, long long /*t*/) {}
+    void onTerminate(const Process *, TermReason, long long /*t*/) {}
+};
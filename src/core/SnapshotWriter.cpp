@@ -0,0 +1,249 @@
+#include "core/SnapshotWriter.h"
+#include "processors/Processor.h"
+#include <chrono>
+#include <iostream>
+
+using namespace snaprec;
+
+// ================= SnapshotRenderer =================
+void SnapshotRenderer::render(const std::int64_t *p, std::size_t n, std::ostream &os)
+{
+    const std::int64_t *endp = p + n;
+    while (p < endp)
+    {
+        std::int64_t kind = p[0];
+        std::int64_t len = p[1];
+        const std::int64_t *body = p + 2;
+        switch (kind)
+        {
+        case REC_NEW_LIST:
+            newList.assign(body + 1, body + 1 + 2 * body[0]);
+            newFront = 0;
+            break;
+        case REC_SNAPSHOT:
+            renderSnapshot(body, os);
+            break;
+        case REC_PROCESSOR:
+            renderProcessor(body, os);
+            break;
+        default:
+            break;
+        }
+        p = body + len;
+    }
+}
+
+void SnapshotRenderer::renderSnapshot(const std::int64_t *p, std::ostream &os)
+{
+    std::int64_t t = *p++;
+    std::size_t newSize = (std::size_t)*p++;
+    while (newList.size() / 2 - newFront > newSize)
+        ++newFront;
+
+    os << "\n================= Timestep " << t << " =================\n";
+
+    // NEW list (not just count)
+    os << "NEW: ";
+    if (newFront * 2 == newList.size())
+        os << "EMPTY";
+    for (std::size_t i = newFront; i < newList.size() / 2; ++i)
+    {
+        os << newList[2 * i] << "(AT=" << newList[2 * i + 1] << ")";
+        if (i + 1 < newList.size() / 2)
+            os << ", ";
+    }
+    os << "\n";
+
+    // IO device
+    std::int64_t ioPid = *p++;
+    std::int64_t ioRemaining = *p++;
+    os << "I/O device: ";
+    if (ioPid >= 0)
+        os << "PID=" << ioPid << " (remainingIO=" << ioRemaining << ")";
+    else
+        os << "IDLE";
+    os << "\n";
+
+    // BLK waiting queue
+    std::int64_t nBlk = *p++;
+    os << "BLK(wait): ";
+    if (nBlk == 0)
+        os << "EMPTY";
+    for (std::int64_t i = 0; i < nBlk; ++i, p += 2)
+    {
+        os << p[0] << "(IO=" << p[1] << ")";
+        if (i + 1 < nBlk)
+            os << ", ";
+    }
+    os << "\n";
+
+    // TRM list
+    std::int64_t nTrm = *p++;
+    trm.insert(trm.end(), p, p + 2 * nTrm);
+    p += 2 * nTrm;
+    os << "TRM: ";
+    if (trm.empty())
+        os << "EMPTY";
+    for (std::size_t i = 0; i < trm.size(); i += 2)
+    {
+        os << trm[i];
+        if (trm[i + 1] >= 0)
+            os << "(TT=" << trm[i + 1] << ")";
+        if (i + 2 < trm.size())
+            os << ", ";
+    }
+    os << "\n";
+
+    // Processor view
+    os << "------------------ Processors ------------------\n";
+    std::int64_t nProcs = *p++;
+    for (std::int64_t i = 0; i < nProcs; ++i)
+        p = renderProcessor(p, os);
+    os << "------------------------------------------------\n";
+}
+
+const std::int64_t *SnapshotRenderer::renderProcessor(const std::int64_t *p, std::ostream &os)
+{
+    std::int64_t id = *p++;
+    ProcType tp = (ProcType)*p++;
+    os << "P" << id << " [" << procTypeName(tp) << "]\n";
+
+    std::int64_t nRdy = *p++;
+    os << "  RDY: ";
+    for (std::int64_t i = 0; i < nRdy; ++i, p += 2)
+    {
+        if (i > 0)
+            os << ",";
+        os << p[0];
+        if (p[1] >= 0)
+            os << "(L" << p[1] << ")";
+    }
+    if (nRdy == 0)
+        os << "EMPTY";
+    os << "\n";
+
+    std::int64_t runPid = p[0], rem = p[1], exec = p[2], q = p[3], slice = p[4], lax = p[5];
+    std::int64_t busy = p[6], idle = p[7];
+    p += 8;
+
+    os << "  RUN: ";
+    if (runPid < 0)
+    {
+        os << "IDLE\n";
+    }
+    else
+    {
+        os << "PID=" << runPid << " rem=" << rem << " exec=" << exec;
+        if (tp == ProcType::RR || tp == ProcType::MLFQ || tp == ProcType::CFS)
+            os << " q=" << q << "/" << slice;
+        if (lax != NO_LAXITY)
+            os << " lax=" << lax;
+        os << "\n";
+    }
+
+    os << "  CPU stats: busy=" << busy << " idle=" << idle << "\n";
+    return p;
+}
+
+// ================= SnapshotWriter =================
+SnapshotWriter::SnapshotWriter()
+    : ring(nullptr), closing(false), os(nullptr), pacing(Pacing::None),
+      chunkPos(0), chunkLen(0) {}
+
+SnapshotWriter::~SnapshotWriter()
+{
+    finish();
+}
+
+void SnapshotWriter::start(std::ostream &out, Pacing p, std::size_t ringWords)
+{
+    finish();
+    ring = new SpscRing<std::int64_t>(ringWords);
+    os = &out;
+    pacing = p;
+    closing.store(false);
+    chunkPos = chunkLen = 0;
+    renderer = SnapshotRenderer();
+    th = std::thread(&SnapshotWriter::consume, this);
+}
+
+void SnapshotWriter::push()
+{
+    const std::int64_t *src = rec.data();
+    std::size_t left = rec.size();
+    while (left > 0)
+    {
+        std::size_t n = ring->write(src, left);
+        src += n;
+        left -= n;
+        if (n == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(100)); // ring full
+    }
+}
+
+void SnapshotWriter::finish()
+{
+    if (!ring)
+        return;
+    closing.store(true, std::memory_order_release);
+    th.join();
+    delete ring;
+    ring = nullptr;
+}
+
+bool SnapshotWriter::get(std::int64_t *dst, std::size_t n)
+{
+    while (n > 0)
+    {
+        if (chunkPos == chunkLen)
+        {
+            // read `closing` first: anything pushed before it was set is in the ring
+            bool closed = closing.load(std::memory_order_acquire);
+            chunkLen = ring->read(chunk, sizeof chunk / sizeof chunk[0]);
+            chunkPos = 0;
+            if (chunkLen == 0)
+            {
+                if (closed)
+                    return false;
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                continue;
+            }
+        }
+        std::size_t k = chunkLen - chunkPos;
+        if (k > n)
+            k = n;
+        for (std::size_t i = 0; i < k; ++i)
+            *dst++ = chunk[chunkPos++];
+        n -= k;
+    }
+    return true;
+}
+
+void SnapshotWriter::consume()
+{
+    std::vector<std::int64_t> buf;
+    std::int64_t hdr[2];
+    while (get(hdr, 2))
+    {
+        buf.resize(2 + (std::size_t)hdr[1]);
+        buf[0] = hdr[0];
+        buf[1] = hdr[1];
+        if (!get(buf.data() + 2, (std::size_t)hdr[1]))
+            break;
+        renderer.render(buf.data(), buf.size(), *os);
+
+        if (hdr[0] != REC_SNAPSHOT)
+            continue;
+        if (pacing == Pacing::Enter)
+        {
+            *os << "Press Enter to continue..." << std::flush;
+            std::cin.get();
+        }
+        else if (pacing == Pacing::OneSecond)
+        {
+            os->flush();
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+    os->flush();
+}
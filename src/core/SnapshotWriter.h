@@ -0,0 +1,113 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <thread>
+#include <vector>
+#include "ds/SpscRing.h"
+
+// Snapshot records: int64 words framed as [kind, payload length, payload].
+// The Scheduler encodes them (see encodeSnapshot); SnapshotRenderer turns
+// them into the snapshot text. NEW only loses entries at the front and TRM
+// only grows at the back, so after one REC_NEW_LIST a snapshot carries
+// the NEW size and the TRM entries added since the previous record.
+//
+// REC_NEW_LIST: n, n x (pid, AT)
+// REC_SNAPSHOT: t, NEW size, IO pid (-1 idle), IO remaining,
+//               n, n x (pid, pending IO)   BLK wait
+//               n, n x (pid, TT)           new TRM entries
+//               n, n x processor
+// REC_PROCESSOR (also the processor layout inside a snapshot):
+//               id, type, n, n x (pid, MLFQ level or -1),
+//               RUN pid (-1 idle), remaining, executed, quantum, slice,
+//               laxity (NO_LAXITY: not shown), busy, idle
+namespace snaprec
+{
+    enum Kind : std::int64_t
+    {
+        REC_NEW_LIST = 1,
+        REC_SNAPSHOT = 2,
+        REC_PROCESSOR = 3
+    };
+    constexpr std::int64_t NO_LAXITY = INT64_MIN;
+
+    // start a record; returns the index of its length word for end()
+    inline std::size_t begin(std::vector<std::int64_t> &rec, Kind k)
+    {
+        rec.push_back(k);
+        rec.push_back(0);
+        return rec.size() - 1;
+    }
+    inline void end(std::vector<std::int64_t> &rec, std::size_t lenAt)
+    {
+        rec[lenAt] = (std::int64_t)(rec.size() - lenAt - 1);
+    }
+}
+
+// Keeps the NEW / TRM lists the delta records refer to.
+class SnapshotRenderer
+{
+private:
+    std::vector<std::int64_t> newList; // pid, AT pairs
+    std::size_t newFront = 0;          // pairs already admitted
+    std::vector<std::int64_t> trm;     // pid, TT pairs
+
+    void renderSnapshot(const std::int64_t *p, std::ostream &os);
+    static const std::int64_t *renderProcessor(const std::int64_t *p, std::ostream &os);
+
+public:
+    // renders every record in [p, p + n)
+    void render(const std::int64_t *p, std::size_t n, std::ostream &os);
+};
+
+// Renders and paces snapshots on a background thread. The simulation
+// thread copies each encoded record into an SPSC ring and goes on with
+// the next tick; the writer prints and then waits for Enter (interactive)
+// or one second (step) without holding up the simulation. A full ring
+// makes the producer wait (backpressure).
+class SnapshotWriter
+{
+public:
+    enum class Pacing
+    {
+        None,
+        Enter,
+        OneSecond
+    };
+
+private:
+    SpscRing<std::int64_t> *ring;
+    std::thread th;
+    std::atomic<bool> closing;
+    std::ostream *os;
+    Pacing pacing;
+    std::vector<std::int64_t> rec; // producer scratch
+
+    // consumer side
+    std::int64_t chunk[4096];
+    std::size_t chunkPos, chunkLen;
+    SnapshotRenderer renderer;
+    bool get(std::int64_t *dst, std::size_t n); // blocks; false once closed and drained
+    void consume();
+
+public:
+    SnapshotWriter();
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter &) = delete;
+    SnapshotWriter &operator=(const SnapshotWriter &) = delete;
+
+    void start(std::ostream &out, Pacing p, std::size_t ringWords = std::size_t(1) << 20);
+    bool running() const { return ring != nullptr; }
+
+    // producer: fill record() (cleared), then push() it
+    std::vector<std::int64_t> &record()
+    {
+        rec.clear();
+        return rec;
+    }
+    void push();
+
+    // waits until everything pushed has been shown
+    void finish();
+};
@@ -0,0 +1,105 @@
+#include "core/TaskGenerator.h"
+#include <algorithm>
+#include <climits>
+#include "model/Process.h"
+
+TaskGenerator::TaskGenerator() : tasks(nullptr), pending(&TaskGenerator::earlier) {}
+
+bool TaskGenerator::earlier(const Release &a, const Release &b)
+{
+    if (a.at != b.at)
+        return a.at < b.at;
+    return a.pid < b.pid;
+}
+
+void TaskGenerator::init(const std::vector<TaskSpec> &specs)
+{
+    tasks = &specs;
+    released.assign(specs.size(), 0);
+    rng.assign(specs.size(), 0);
+    pending.clear();
+    for (std::size_t i = 0; i < specs.size(); ++i)
+    {
+        rng[i] = specs[i].seed;
+        if (jobBound(specs[i]) > 0)
+            pending.push(Release{specs[i].offset, specs[i].pid, (int)i});
+    }
+}
+
+void TaskGenerator::copyFrom(const TaskGenerator &o, const std::vector<TaskSpec> &specs)
+{
+    tasks = &specs;
+    released = o.released;
+    rng = o.rng;
+    pending.copyFrom(o.pending, [](const Release &r)
+                     { return r; });
+}
+
+long long TaskGenerator::nextAt() const
+{
+    return pending.empty() ? LLONG_MAX : pending.raw()[0].at;
+}
+
+int TaskGenerator::nextPid() const
+{
+    return pending.empty() ? INT_MAX : pending.raw()[0].pid;
+}
+
+// 64-bit LCG (Knuth's MMIX constants); the top 53 bits pick the jitter
+long long TaskGenerator::nextGap(int task)
+{
+    const TaskSpec &t = (*tasks)[task];
+    if (!t.sporadic || t.jitter == 0)
+        return t.period;
+    rng[task] = rng[task] * 6364136223846793005ull + 1442695040888963407ull;
+    return t.period + (long long)((rng[task] >> 11) % ((std::uint64_t)t.jitter + 1));
+}
+
+Process *TaskGenerator::release()
+{
+    Release r = pending.pop();
+    const TaskSpec &t = (*tasks)[r.task];
+
+    IORequest *ioArr = nullptr;
+    if (!t.io.empty())
+    {
+        ioArr = new IORequest[t.io.size()];
+        for (std::size_t k = 0; k < t.io.size(); ++k)
+            ioArr[k] = t.io[k];
+    }
+    Process *p = new Process(r.pid, r.at, t.CT, (int)t.io.size(), ioArr);
+    if (t.DL >= 0)
+        p->setDeadline(r.at + t.DL);
+    p->setWeight(t.weight);
+
+    long long n = ++released[r.task];
+    long long gap = nextGap(r.task);
+    if ((t.count < 0 || n < t.count) && gap <= LLONG_MAX - r.at &&
+        (t.until < 0 || r.at + gap < t.until))
+        pending.push(Release{r.at + gap, r.pid + 1, r.task});
+    return p;
+}
+
+long long TaskGenerator::jobBound(const TaskSpec &t)
+{
+    long long n = t.count;
+    if (t.until >= 0)
+    {
+        long long span = t.until - t.offset;
+        long long byTime = span <= 0 ? 0 : span / t.period + (span % t.period != 0);
+        n = (n < 0) ? byTime : std::min(n, byTime);
+    }
+    return n < 0 ? 0 : n;
+}
+
+int TaskGenerator::maxPid(const std::vector<TaskSpec> &specs)
+{
+    long long mx = 0;
+    for (const TaskSpec &t : specs)
+    {
+        long long n = jobBound(t);
+        if (n > 0)
+            mx = std::max(mx, t.pid + n - 1);
+    }
+    return mx > INT_MAX ? INT_MAX : (int)mx;
+}
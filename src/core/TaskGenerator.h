@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "ds/MinHeap.h"
+#include "model/TaskSpec.h"
+
+class Process;
+
+// Releases the jobs of the input's periodic / sporadic tasks one at a time,
+// earliest first (PID breaks ties, as in NEW). Only the next release of each
+// task is kept, so a task with a million jobs costs one heap entry until its
+// jobs actually arrive.
+class TaskGenerator
+{
+private:
+    struct Release
+    {
+        long long at;
+        int pid;
+        int task;
+    };
+    static bool earlier(const Release &a, const Release &b);
+
+    const std::vector<TaskSpec> *tasks;
+    std::vector<long long> released; // jobs released so far, per task
+    std::vector<std::uint64_t> rng;  // sporadic jitter state, per task
+    MinHeap<Release> pending;        // next release of every unfinished task
+
+    long long nextGap(int task);
+
+public:
+    TaskGenerator();
+
+    TaskGenerator(const TaskGenerator &) = delete;
+    TaskGenerator &operator=(const TaskGenerator &) = delete;
+
+    // specs must outlive the generator
+    void init(const std::vector<TaskSpec> &specs);
+    // o's progress over `specs` (a copy of o's)
+    void copyFrom(const TaskGenerator &o, const std::vector<TaskSpec> &specs);
+
+    bool empty() const { return pending.empty(); }
+    long long nextAt() const; // LLONG_MAX when empty
+    int nextPid() const;
+
+    // the earliest pending job, a new Process owned by the caller
+    Process *release();
+
+    // upper bound on the jobs of a task (exact for periodic ones)
+    static long long jobBound(const TaskSpec &t);
+    // largest PID any job could get, 0 without tasks
+    static int maxPid(const std::vector<TaskSpec> &specs);
+};
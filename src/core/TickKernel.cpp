@@ -0,0 +1,286 @@
+#include "core/TickKernel.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TICK_KERNEL_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TICK_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TICK_TARGET_AVX2
+#endif
+
+void RunLanes::init(std::size_t n)
+{
+    release();
+    count = (n + 63) / 64 * 64;
+    if (count == 0)
+        return;
+    remaining = new std::int32_t[count]();
+    executed = new std::int32_t[count]();
+    nextIO = new std::int32_t[count]();
+    quantum = new std::int32_t[count]();
+    slice = new std::int32_t[count]();
+    speed = new std::int32_t[count];
+    accum = new std::int32_t[count]();
+    for (std::size_t i = 0; i < count; ++i)
+        speed[i] = SPEED_ONE;
+}
+
+void RunLanes::release()
+{
+    delete[] remaining;
+    delete[] executed;
+    delete[] nextIO;
+    delete[] quantum;
+    delete[] slice;
+    delete[] speed;
+    delete[] accum;
+    remaining = executed = nextIO = quantum = slice = speed = accum = nullptr;
+    count = 0;
+}
+
+// ------------------ scalar ------------------
+static void tickScalar(RunLanes &l, const std::uint64_t *running, std::size_t words, const TickMasks &out)
+{
+    for (std::size_t w = 0; w < words; ++w)
+    {
+        std::uint64_t bits = running[w];
+        std::uint64_t fin = 0, io = 0, qe = 0;
+
+        for (unsigned b = 0; bits; ++b, bits >>= 1)
+        {
+            if (!(bits & 1u))
+                continue;
+            std::size_t i = w * 64 + b;
+            std::uint64_t bit = std::uint64_t(1) << b;
+
+            if (l.remaining[i] > 0)
+            {
+                std::int32_t acc = l.accum[i] + l.speed[i];
+                std::int32_t step = acc >> SPEED_SHIFT;
+                l.accum[i] = acc & (SPEED_ONE - 1);
+                if (step > l.remaining[i])
+                    step = l.remaining[i];
+                std::int32_t gap = l.nextIO[i] - l.executed[i];
+                if (gap > 0 && step > gap)
+                    step = gap;
+                l.remaining[i] -= step;
+                l.executed[i] += step;
+            }
+            if (l.slice[i] > 0 && ++l.quantum[i] >= l.slice[i])
+                qe |= bit;
+            if (l.remaining[i] <= 0)
+                fin |= bit;
+            if (l.executed[i] == l.nextIO[i])
+                io |= bit;
+        }
+
+        out.finished[w] = fin;
+        out.ioDue[w] = io;
+        out.quantumExpired[w] = qe;
+        out.any[w] = fin | io | qe;
+    }
+}
+
+#ifdef TICK_KERNEL_X86
+// ------------------ SSE2 (4 lanes) ------------------
+static inline __m128i minEpi32SSE2(__m128i a, __m128i b)
+{
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+static void tickSSE2(RunLanes &l, const std::uint64_t *running, std::size_t words, const TickMasks &out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i laneBit = _mm_setr_epi32(1, 2, 4, 8);
+    const __m128i fracMask = _mm_set1_epi32(SPEED_ONE - 1);
+
+    for (std::size_t w = 0; w < words; ++w)
+    {
+        std::uint64_t bits = running[w];
+        std::uint64_t fin = 0, io = 0, qe = 0;
+
+        for (unsigned k = 0; bits && k < 16; ++k)
+        {
+            int m = (int)((bits >> (4 * k)) & 0xF);
+            if (!m)
+                continue;
+            std::size_t base = w * 64 + 4 * k;
+
+            __m128i active = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(m), laneBit), laneBit);
+            __m128i rem = _mm_loadu_si128((const __m128i *)(l.remaining + base));
+            __m128i exe = _mm_loadu_si128((const __m128i *)(l.executed + base));
+            __m128i nio = _mm_loadu_si128((const __m128i *)(l.nextIO + base));
+            __m128i qc = _mm_loadu_si128((const __m128i *)(l.quantum + base));
+            __m128i sl = _mm_loadu_si128((const __m128i *)(l.slice + base));
+            __m128i acc = _mm_loadu_si128((const __m128i *)(l.accum + base));
+            __m128i spd = _mm_loadu_si128((const __m128i *)(l.speed + base));
+
+            // step = whole units of accum + speed, capped by remaining and the IO gap
+            __m128i canRun = _mm_and_si128(active, _mm_cmpgt_epi32(rem, zero));
+            acc = _mm_add_epi32(acc, _mm_and_si128(spd, canRun));
+            __m128i step = minEpi32SSE2(_mm_srli_epi32(acc, SPEED_SHIFT), rem);
+            acc = _mm_and_si128(acc, fracMask);
+            __m128i gap = _mm_sub_epi32(nio, exe);
+            __m128i capped = _mm_and_si128(_mm_cmpgt_epi32(gap, zero), _mm_cmpgt_epi32(step, gap));
+            step = _mm_or_si128(_mm_and_si128(capped, gap), _mm_andnot_si128(capped, step));
+            step = _mm_and_si128(step, canRun);
+            rem = _mm_sub_epi32(rem, step);
+            exe = _mm_add_epi32(exe, step);
+
+            // all-ones lanes are -1: subtract from counters
+            __m128i qa = _mm_and_si128(active, _mm_cmpgt_epi32(sl, zero));
+            qc = _mm_sub_epi32(qc, qa);
+
+            __m128i f = _mm_andnot_si128(_mm_cmpgt_epi32(rem, zero), active);
+            __m128i d = _mm_and_si128(active, _mm_cmpeq_epi32(exe, nio));
+            __m128i q = _mm_andnot_si128(_mm_cmpgt_epi32(sl, qc), qa);
+
+            _mm_storeu_si128((__m128i *)(l.remaining + base), rem);
+            _mm_storeu_si128((__m128i *)(l.executed + base), exe);
+            _mm_storeu_si128((__m128i *)(l.quantum + base), qc);
+            _mm_storeu_si128((__m128i *)(l.accum + base), acc);
+
+            unsigned shift = 4 * k;
+            fin |= (std::uint64_t)_mm_movemask_ps(_mm_castsi128_ps(f)) << shift;
+            io |= (std::uint64_t)_mm_movemask_ps(_mm_castsi128_ps(d)) << shift;
+            qe |= (std::uint64_t)_mm_movemask_ps(_mm_castsi128_ps(q)) << shift;
+        }
+
+        out.finished[w] = fin;
+        out.ioDue[w] = io;
+        out.quantumExpired[w] = qe;
+        out.any[w] = fin | io | qe;
+    }
+}
+
+// ------------------ AVX2 (8 lanes) ------------------
+TICK_TARGET_AVX2
+static void tickAVX2(RunLanes &l, const std::uint64_t *running, std::size_t words, const TickMasks &out)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i laneBit = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i fracMask = _mm256_set1_epi32(SPEED_ONE - 1);
+
+    for (std::size_t w = 0; w < words; ++w)
+    {
+        std::uint64_t bits = running[w];
+        std::uint64_t fin = 0, io = 0, qe = 0;
+
+        for (unsigned k = 0; bits && k < 8; ++k)
+        {
+            int m = (int)((bits >> (8 * k)) & 0xFF);
+            if (!m)
+                continue;
+            std::size_t base = w * 64 + 8 * k;
+
+            __m256i active = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(m), laneBit), laneBit);
+            __m256i rem = _mm256_loadu_si256((const __m256i *)(l.remaining + base));
+            __m256i exe = _mm256_loadu_si256((const __m256i *)(l.executed + base));
+            __m256i nio = _mm256_loadu_si256((const __m256i *)(l.nextIO + base));
+            __m256i qc = _mm256_loadu_si256((const __m256i *)(l.quantum + base));
+            __m256i sl = _mm256_loadu_si256((const __m256i *)(l.slice + base));
+            __m256i acc = _mm256_loadu_si256((const __m256i *)(l.accum + base));
+            __m256i spd = _mm256_loadu_si256((const __m256i *)(l.speed + base));
+
+            __m256i canRun = _mm256_and_si256(active, _mm256_cmpgt_epi32(rem, zero));
+            acc = _mm256_add_epi32(acc, _mm256_and_si256(spd, canRun));
+            __m256i step = _mm256_min_epi32(_mm256_srli_epi32(acc, SPEED_SHIFT), rem);
+            acc = _mm256_and_si256(acc, fracMask);
+            __m256i gap = _mm256_sub_epi32(nio, exe);
+            __m256i capped = _mm256_and_si256(_mm256_cmpgt_epi32(gap, zero), _mm256_cmpgt_epi32(step, gap));
+            step = _mm256_blendv_epi8(step, gap, capped);
+            step = _mm256_and_si256(step, canRun);
+            rem = _mm256_sub_epi32(rem, step);
+            exe = _mm256_add_epi32(exe, step);
+            __m256i qa = _mm256_and_si256(active, _mm256_cmpgt_epi32(sl, zero));
+            qc = _mm256_sub_epi32(qc, qa);
+
+            __m256i f = _mm256_andnot_si256(_mm256_cmpgt_epi32(rem, zero), active);
+            __m256i d = _mm256_and_si256(active, _mm256_cmpeq_epi32(exe, nio));
+            __m256i q = _mm256_andnot_si256(_mm256_cmpgt_epi32(sl, qc), qa);
+
+            _mm256_storeu_si256((__m256i *)(l.remaining + base), rem);
+            _mm256_storeu_si256((__m256i *)(l.executed + base), exe);
+            _mm256_storeu_si256((__m256i *)(l.quantum + base), qc);
+            _mm256_storeu_si256((__m256i *)(l.accum + base), acc);
+
+            unsigned shift = 8 * k;
+            fin |= (std::uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(f)) << shift;
+            io |= (std::uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(d)) << shift;
+            qe |= (std::uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(q)) << shift;
+        }
+
+        out.finished[w] = fin;
+        out.ioDue[w] = io;
+        out.quantumExpired[w] = qe;
+        out.any[w] = fin | io | qe;
+    }
+}
+
+static bool cpuHasAVX2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    return avx2 && osxsave && ((_xgetbv(0) & 0x6) == 0x6);
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+using TickFn = void (*)(RunLanes &, const std::uint64_t *, std::size_t, const TickMasks &);
+
+struct TickImpl
+{
+    TickFn fn;
+    const char *name;
+};
+
+// PS_TICK_KERNEL=scalar|sse2 forces a narrower implementation (for comparison)
+static TickImpl selectTickImpl()
+{
+    const char *force = std::getenv("PS_TICK_KERNEL");
+    if (force && std::strcmp(force, "scalar") == 0)
+        return {&tickScalar, "scalar"};
+#ifdef TICK_KERNEL_X86
+    if (force && std::strcmp(force, "sse2") == 0)
+        return {&tickSSE2, "sse2"};
+    if (cpuHasAVX2())
+        return {&tickAVX2, "avx2"};
+    return {&tickSSE2, "sse2"};
+#else
+    return {&tickScalar, "scalar"};
+#endif
+}
+
+static const TickImpl &tickImpl()
+{
+    static const TickImpl impl = selectTickImpl();
+    return impl;
+}
+
+void tickKernel(RunLanes &lanes, const std::uint64_t *running, std::size_t words, const TickMasks &out)
+{
+    tickImpl().fn(lanes, running, words, out);
+}
+
+const char *tickKernelName()
+{
+    return tickImpl().name;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Processor speed in fixed point: SPEED_ONE retires one unit of CT per tick.
+constexpr int SPEED_SHIFT = 10;
+constexpr std::int32_t SPEED_ONE = 1 << SPEED_SHIFT;
+constexpr std::int32_t SPEED_MAX = 64 * SPEED_ONE;
+
+// Hot state of the process running on each CPU, one lane per processor ID.
+// While a process is RUN, its lane (not the Process fields) is authoritative;
+// Processor::setRunning/clearRunning load and store it.
+struct RunLanes
+{
+    std::int32_t *remaining;
+    std::int32_t *executed;
+    std::int32_t *nextIO;  // executed time of the next IO request, -1 if none
+    std::int32_t *quantum; // RR quantum counter
+    std::int32_t *slice;   // RR time slice, 0 = no quantum
+    std::int32_t *speed;   // CPU speed (SPEED_ONE units), fixed per processor
+    std::int32_t *accum;   // fractional work carried to the next tick, < SPEED_ONE
+    std::size_t count;     // padded to a multiple of 64
+
+    RunLanes() : remaining(nullptr), executed(nullptr), nextIO(nullptr),
+                 quantum(nullptr), slice(nullptr), speed(nullptr), accum(nullptr), count(0) {}
+    ~RunLanes() { release(); }
+
+    RunLanes(const RunLanes &) = delete;
+    RunLanes &operator=(const RunLanes &) = delete;
+
+    void init(std::size_t n);
+    void release();
+};
+
+// Per-word output masks of tickKernel (one bit per processor ID).
+struct TickMasks
+{
+    std::uint64_t *finished;
+    std::uint64_t *ioDue;
+    std::uint64_t *quantumExpired;
+    std::uint64_t *any; // union of the three
+};
+
+// Executes one CPU tick on every lane whose `running` bit is set and
+// reports which lanes finished, reached their next IO, or used up their
+// quantum. A lane retires floor((accum + speed) / SPEED_ONE) units, never
+// past its remaining work or its next IO request, and keeps the fraction.
+// Picks an AVX2 / SSE2 / scalar implementation at first call.
+void tickKernel(RunLanes &lanes, const std::uint64_t *running, std::size_t words, const TickMasks &out);
+
+// name of the implementation tickKernel dispatches to
+const char *tickKernelName();
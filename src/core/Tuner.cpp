@@ -0,0 +1,340 @@
+#include "core/Tuner.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <thread>
+
+Tuner::Tuner() : span(0) {}
+
+Tuner::~Tuner()
+{
+    for (Candidate &c : cands)
+        delete c.sim;
+}
+
+const char *Tuner::objectiveName(Objective o)
+{
+    switch (o)
+    {
+    case Objective::AvgTRT:
+        return "avg-trt";
+    case Objective::P99TRT:
+        return "p99-trt";
+    case Objective::DeadlineMet:
+        return "dl-met";
+    case Objective::Utilization:
+        return "util";
+    }
+    return "?";
+}
+
+bool Tuner::parseObjective(const std::string &name, Objective &out)
+{
+    const Objective all[] = {Objective::AvgTRT, Objective::P99TRT,
+                             Objective::DeadlineMet, Objective::Utilization};
+    for (Objective o : all)
+    {
+        if (name == objectiveName(o))
+        {
+            out = o;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Tuner::load(const std::string &inputPath, std::string &err)
+{
+    ParsedInput in;
+    if (!InputParser::parseFile(inputPath, in, err))
+        return false;
+    base = in;
+    InputParser::toSpecs(in, procs, kills);
+    // every candidate builds its own processes from the specs
+    for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+        delete n->data;
+
+    // makespan lower bound for the input's mix: last arrival, or all the
+    // work spread evenly at speed 1
+    long long lastAT = 0, work = 0;
+    for (const ProcessSpec &ps : procs)
+    {
+        lastAT = std::max<long long>(lastAT, ps.AT);
+        work += ps.CT;
+    }
+    // task jobs: sporadic ones at their mean gap
+    for (const TaskSpec &ts : base.tasks)
+    {
+        long long jobs = TaskGenerator::jobBound(ts);
+        long long last = ts.offset + (jobs - 1) * (ts.period + ts.jitter / 2);
+        lastAT = std::max(lastAT, ts.until >= 0 ? std::min(last, ts.until - 1) : last);
+        work += jobs * ts.CT;
+    }
+    int cpus = std::max(1, base.NF + base.NS + base.NR + base.NE + base.NM + base.NC + base.NL);
+    span = std::max(lastAT, work / cpus) + 1;
+    return true;
+}
+
+// candidate 0 is the input as is; the others are drawn around it
+void Tuner::makeCandidates()
+{
+    std::uint32_t rng = opt.seed;
+    auto draw = [&](int lo, int hi)
+    {
+        rng = rng * 1664525u + 1013904223u;
+        return lo + (int)((rng >> 8) % (std::uint32_t)(hi - lo + 1));
+    };
+
+    const Params input = {base.RTF, base.MaxW, base.STL, base.timeSlice,
+                          base.NF, base.NS, base.NR, base.NE};
+    const int mixTotal = input.NF + input.NS + input.NR + input.NE;
+
+    cands.clear();
+    for (int i = 0; i < opt.candidates; ++i)
+    {
+        Params p = input;
+        if (i > 0)
+        {
+            p.RTF = draw(1, std::max(20, 4 * input.RTF));
+            p.MaxW = draw(1, std::max(50, 4 * input.MaxW));
+            p.STL = draw(0, std::max(50, 4 * input.STL));
+            p.timeSlice = draw(1, std::max(10, 4 * input.timeSlice));
+            if (opt.tuneMix && mixTotal > 0)
+            {
+                // three cut points in [0, total]
+                int a = draw(0, mixTotal), b = draw(0, mixTotal), c = draw(0, mixTotal);
+                if (a > b)
+                    std::swap(a, b);
+                if (b > c)
+                    std::swap(b, c);
+                if (a > b)
+                    std::swap(a, b);
+                p.NF = a;
+                p.NS = b - a;
+                p.NR = c - b;
+                p.NE = mixTotal - c;
+            }
+        }
+        cands.push_back(Candidate{i, p, nullptr, 0.0, 0});
+    }
+}
+
+bool Tuner::start(Candidate &c, std::string &err) const
+{
+    SimConfig cfg = base;
+    cfg.RTF = c.params.RTF;
+    cfg.MaxW = c.params.MaxW;
+    cfg.STL = c.params.STL;
+    cfg.timeSlice = c.params.timeSlice;
+    cfg.NF = c.params.NF;
+    cfg.NS = c.params.NS;
+    cfg.NR = c.params.NR;
+    cfg.NE = c.params.NE;
+
+    c.sim = new Scheduler();
+    c.sim->setDeadlinePolicy(opt.dlPolicy);
+    c.sim->setReadyQueueKind(opt.rdyKind);
+    c.sim->setHorizon(opt.horizon);
+    c.sim->seedForkRng(opt.seed);
+    if (!c.sim->load(cfg, procs.data(), (int)procs.size(), kills.data(), (int)kills.size(), err))
+        return false;
+    return true;
+}
+
+// The objective over the processes that have arrived so far. A process
+// still running counts with its TRT so far (a lower bound), and a deadline
+// counts once it is met or already past, so paused runs of different
+// candidates are compared on the same arrivals.
+double Tuner::score(const Scheduler &s) const
+{
+    const long long now = s.currentTick();
+    std::vector<long long> trt;
+    int dlMet = 0, dlDue = 0;
+    s.forEachProcess([&](const Process *p)
+                     {
+                         if (p->getState() == ProcState::NEW)
+                             return;
+                         bool done = p->getState() == ProcState::TRM;
+                         trt.push_back((done ? p->getTT() : now) - p->getAT());
+                         if (!p->hasDeadline())
+                             return;
+                         if (done && p->isFinished())
+                         {
+                             ++dlDue;
+                             if (p->getTT() <= p->getDeadline())
+                                 ++dlMet;
+                         }
+                         else if (!done && p->getDeadline() < now)
+                             ++dlDue; });
+
+    switch (opt.objective)
+    {
+    case Objective::AvgTRT:
+    {
+        if (trt.empty())
+            return 0.0;
+        long long sum = 0;
+        for (long long v : trt)
+            sum += v;
+        return (double)sum / trt.size();
+    }
+    case Objective::P99TRT:
+    {
+        if (trt.empty())
+            return 0.0;
+        std::size_t k = (trt.size() * 99 + 99) / 100 - 1; // nearest rank
+        std::nth_element(trt.begin(), trt.begin() + k, trt.end());
+        return trt[k];
+    }
+    case Objective::DeadlineMet:
+        return dlDue ? -100.0 * dlMet / dlDue : -100.0;
+    case Objective::Utilization:
+    {
+        RunTotals r = s.totals();
+        long long total = r.busy + r.idle;
+        return total ? -100.0 * r.busy / total : 0.0;
+    }
+    }
+    return 0.0;
+}
+
+// horizon < 0: run to the end
+void Tuner::runRound(std::vector<Candidate *> &alive, long long horizon) const
+{
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]()
+    {
+        for (std::size_t i = next++; i < alive.size(); i = next++)
+        {
+            Candidate &c = *alive[i];
+            c.sim->runUntil(horizon < 0 ? LLONG_MAX : horizon);
+            c.score = score(*c.sim);
+            c.lastTick = c.sim->currentTick();
+        }
+    };
+
+    int n = std::min<int>(opt.threads, (int)alive.size());
+    std::vector<std::thread> pool;
+    for (int i = 1; i < n; ++i)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &th : pool)
+        th.join();
+
+    std::stable_sort(alive.begin(), alive.end(), [](const Candidate *a, const Candidate *b)
+                     { return a->score < b->score; });
+}
+
+void Tuner::printParams(std::ostream &os, const Params &p) const
+{
+    os << "RTF=" << p.RTF << " MaxW=" << p.MaxW << " STL=" << p.STL << " TS=" << p.timeSlice;
+    if (opt.tuneMix)
+        os << " NF=" << p.NF << " NS=" << p.NS << " NR=" << p.NR << " NE=" << p.NE;
+}
+
+bool Tuner::run(const Options &o, std::ostream &log, std::string &err)
+{
+    opt = o;
+    if (opt.candidates < 1 || opt.eta < 2)
+    {
+        err = "tune needs candidates >= 1 and eta >= 2";
+        return false;
+    }
+    if (opt.tuneMix && !base.speeds.empty())
+    {
+        err = "--mix cannot keep a SPEED line (one value per processor) valid";
+        return false;
+    }
+    if (opt.threads <= 0)
+        opt.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (Candidate &c : cands)
+        delete c.sim;
+    makeCandidates();
+    for (Candidate &c : cands)
+        if (!start(c, err))
+        {
+            err = "candidate #" + std::to_string(c.id) + ": " + err;
+            return false;
+        }
+
+    // rounds so that at most eta candidates are left for the last one; the
+    // prefixes grow by eta up to the estimated span, then the last round
+    // runs to the end
+    int rounds = 1;
+    for (long long n = opt.eta; n < opt.candidates; n *= opt.eta)
+        ++rounds;
+
+    log << "Tuning " << procs.size() << " processes";
+    if (!base.tasks.empty())
+        log << " + " << base.tasks.size() << " tasks";
+    log << ": " << opt.candidates << " candidates, objective "
+        << objectiveName(opt.objective) << ", eta " << opt.eta << ", " << opt.threads << " threads\n";
+
+    std::vector<Candidate *> alive;
+    for (Candidate &c : cands)
+        alive.push_back(&c);
+
+    const bool maximize = opt.objective == Objective::DeadlineMet || opt.objective == Objective::Utilization;
+    for (int r = 0; r < rounds; ++r)
+    {
+        long long horizon = -1;
+        if (r + 1 < rounds)
+        {
+            long long h = opt.horizon > 0 ? std::min(span, opt.horizon) : span;
+            for (int k = r; k < rounds - 2; ++k)
+                h /= opt.eta;
+            horizon = std::max(1LL, h);
+        }
+
+        runRound(alive, horizon);
+
+        log << "Round " << r + 1 << "/" << rounds << ": ";
+        if (horizon < 0)
+            log << "to the end";
+        else
+            log << "until t=" << horizon;
+        log << ", " << alive.size() << " candidates\n";
+        for (const Candidate *c : alive)
+        {
+            log << "  #" << c->id << " ";
+            printParams(log, c->params);
+            log << "  " << objectiveName(opt.objective) << "=" << (maximize ? -c->score : c->score)
+                << " (t=" << c->lastTick << ")\n";
+        }
+
+        if (r + 1 < rounds)
+        {
+            std::size_t keep = (alive.size() + opt.eta - 1) / opt.eta;
+            for (std::size_t i = keep; i < alive.size(); ++i)
+            {
+                delete alive[i]->sim;
+                alive[i]->sim = nullptr;
+            }
+            alive.resize(keep);
+        }
+    }
+
+    const Candidate &b = best();
+    log << "Best: #" << b.id << " ";
+    printParams(log, b.params);
+    log << "  " << objectiveName(opt.objective) << "=" << (maximize ? -b.score : b.score) << "\n";
+    const Candidate &in = cands[0];
+    if (in.id != b.id)
+    {
+        log << "Input: ";
+        printParams(log, in.params);
+        log << "  " << objectiveName(opt.objective) << "=" << (maximize ? -in.score : in.score)
+            << " at t=" << in.lastTick << (in.sim ? "" : " (dropped)") << "\n";
+    }
+    return true;
+}
+
+const Tuner::Candidate &Tuner::best() const
+{
+    const Candidate *b = &cands[0];
+    for (const Candidate &c : cands)
+        if (c.sim && (!b->sim || c.score < b->score))
+            b = &c;
+    return *b;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "core/Scheduler.h"
+
+// `tune`: searches RTF, MaxW, STL and the RR time slice (optionally the
+// NF/NS/NR/NE split of their fixed total) for one input by successive
+// halving. Every candidate runs a prefix of the workload; the better
+// 1/eta go on from where they paused to a longer prefix, the rest are
+// dropped, until the last round runs the survivors to the end.
+// Candidates of a round run concurrently, each on its own Scheduler.
+class Tuner
+{
+public:
+    enum class Objective
+    {
+        AvgTRT,      // minimize
+        P99TRT,      // minimize
+        DeadlineMet, // maximize
+        Utilization  // maximize
+    };
+
+    struct Options
+    {
+        Objective objective = Objective::AvgTRT;
+        int candidates = 16; // including the input's own parameters
+        int threads = 0;     // 0: hardware concurrency
+        int eta = 2;         // keep the best 1/eta each round
+        bool tuneMix = false;
+        std::uint32_t seed = 1; // candidate sampling and every candidate's fork RNG
+        DeadlinePolicy dlPolicy = DeadlinePolicy::Soft;
+        ReadyQueueKind rdyKind = ReadyQueueKind::Radix;
+        long long horizon = 0; // every candidate stops here (0: no limit)
+    };
+
+    struct Params
+    {
+        int RTF, MaxW, STL, timeSlice;
+        int NF, NS, NR, NE;
+    };
+
+    struct Candidate
+    {
+        int id;
+        Params params;
+        Scheduler *sim; // nullptr once dropped
+        double score;   // objective at the last pause, lower is better
+        long long lastTick; // tick the score was taken at
+    };
+
+private:
+    SimConfig base;
+    std::vector<ProcessSpec> procs;
+    std::vector<KillEvent> kills;
+    long long span; // makespan estimate the round horizons are fractions of
+
+    Options opt;
+    std::vector<Candidate> cands;
+
+    void makeCandidates();
+    bool start(Candidate &c, std::string &err) const;
+    double score(const Scheduler &s) const;
+    void runRound(std::vector<Candidate *> &alive, long long horizon) const;
+    void printParams(std::ostream &os, const Params &p) const;
+
+public:
+    Tuner();
+    ~Tuner();
+
+    Tuner(const Tuner &) = delete;
+    Tuner &operator=(const Tuner &) = delete;
+
+    bool load(const std::string &inputPath, std::string &err);
+    bool run(const Options &o, std::ostream &log, std::string &err);
+
+    // after run(): the winner (finished every round)
+    const Candidate &best() const;
+
+    static const char *objectiveName(Objective o);
+    static bool parseObjective(const std::string &name, Objective &out);
+};
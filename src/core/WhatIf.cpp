@@ -0,0 +1,141 @@
+#include "core/WhatIf.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+bool WhatIf::parseBranch(const std::string &spec, const SimConfig &base, SimConfig &out, std::string &err)
+{
+    out = base;
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        std::size_t op = item.find_first_of("=+");
+        if (op == std::string::npos || op == 0 || op + 1 == item.size())
+        {
+            err = "bad branch item: " + item;
+            return false;
+        }
+        std::string key = item.substr(0, op);
+        char *end = nullptr;
+        long v = std::strtol(item.c_str() + op + 1, &end, 10);
+        if (*end)
+        {
+            err = "bad branch value: " + item;
+            return false;
+        }
+
+        int *field = nullptr;
+        if (key == "NF")
+            field = &out.NF;
+        else if (key == "NS")
+            field = &out.NS;
+        else if (key == "NR")
+            field = &out.NR;
+        else if (key == "NE")
+            field = &out.NE;
+        else if (key == "NM")
+            field = &out.NM;
+        else if (key == "NC")
+            field = &out.NC;
+        else if (key == "NL")
+            field = &out.NL;
+        else if (key == "RTF")
+            field = &out.RTF;
+        else if (key == "MaxW")
+            field = &out.MaxW;
+        else if (key == "STL")
+            field = &out.STL;
+        else if (key == "TS")
+            field = &out.timeSlice;
+        else if (key == "ForkProb")
+            field = &out.forkProb;
+        else
+        {
+            err = "unknown branch key: " + key;
+            return false;
+        }
+        *field = (item[op] == '+') ? *field + (int)v : (int)v;
+    }
+    return true;
+}
+
+bool WhatIf::run(const std::string &inputPath, const Options &o, std::ostream &log, std::string &err)
+{
+    Scheduler base;
+    base.setDeadlinePolicy(o.dlPolicy);
+    base.setReadyQueueKind(o.rdyKind);
+    base.setHorizon(o.horizon);
+    base.seedForkRng(o.seed);
+    if (!base.load(inputPath, err))
+        return false;
+
+    // bad change sets fail before anything runs
+    std::vector<SimConfig> cfgs(o.branches.size());
+    for (std::size_t i = 0; i < o.branches.size(); ++i)
+        if (!parseBranch(o.branches[i], base.config(), cfgs[i], err))
+            return false;
+
+    auto t0 = std::chrono::steady_clock::now();
+    base.runUntil(o.at);
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<Scheduler>> sims;
+    sims.emplace_back(base.clone());
+    for (std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        Scheduler *s = base.branch(cfgs[i], err);
+        if (!s)
+        {
+            err = "branch " + std::to_string(i + 1) + " (" + o.branches[i] + "): " + err;
+            return false;
+        }
+        sims.emplace_back(s);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    auto ms = [](std::chrono::steady_clock::duration d)
+    { return std::chrono::duration<double, std::milli>(d).count(); };
+    log << "Ran to t=" << base.currentTick() << " in " << ms(t1 - t0) << " ms, "
+        << sims.size() << " branches cloned in " << ms(t2 - t1) << " ms\n";
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]()
+    {
+        for (std::size_t i = next++; i < sims.size(); i = next++)
+        {
+            sims[i]->runUntil(LLONG_MAX);
+            sims[i]->writeOutputFile(o.outPrefix + std::to_string(i) + ".txt");
+        }
+    };
+    int threads = o.threads > 0 ? o.threads : (int)std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<int>(threads, (int)sims.size());
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; ++i)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &th : pool)
+        th.join();
+    log << "Branches finished in " << ms(std::chrono::steady_clock::now() - t2) << " ms ("
+        << threads << " threads)\n";
+
+    log << "#  end_t  avg_TRT  avg_WT  DL_met%  util%  output  change\n";
+    for (std::size_t i = 0; i < sims.size(); ++i)
+    {
+        RunTotals r = sims[i]->totals();
+        double n = r.count ? (double)r.count : 1.0;
+        log << i << "  " << sims[i]->currentTick()
+            << "  " << r.sumTRT / n
+            << "  " << r.sumWT / n
+            << "  " << (r.dlDone ? 100.0 * r.dlMet / r.dlDone : 0.0)
+            << "  " << (r.busy + r.idle ? 100.0 * r.busy / (r.busy + r.idle) : 0.0)
+            << "  " << o.outPrefix << i << ".txt"
+            << "  " << (i == 0 ? std::string("(none)") : o.branches[i - 1]) << "\n";
+    }
+    return true;
+}
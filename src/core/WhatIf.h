@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "core/Scheduler.h"
+
+// `branch`: runs an input once up to tick T, then clones the simulation
+// into one branch per change set (plus an unchanged control branch) and
+// finishes all of them concurrently. Each branch writes its own output
+// file; a comparison table goes to the log.
+class WhatIf
+{
+public:
+    struct Options
+    {
+        long long at = 0;                  // tick to branch at
+        std::vector<std::string> branches; // change sets, see parseBranch
+        int threads = 0;                   // 0: hardware concurrency
+        std::uint32_t seed = 1;            // fork RNG (branches continue the same stream)
+        DeadlinePolicy dlPolicy = DeadlinePolicy::Soft;
+        ReadyQueueKind rdyKind = ReadyQueueKind::Radix;
+        long long horizon = 0;             // every branch stops here (0: no limit)
+        std::string outPrefix = "data/branch_"; // <prefix><i>.txt, 0 = control
+    };
+
+    // "KEY=V,KEY+N,...": KEY is NF NS NR NE NM NC NL RTF MaxW STL TS
+    // ForkProb; =V sets the value, +N adds to it (processor counts only grow)
+    static bool parseBranch(const std::string &spec, const SimConfig &base, SimConfig &out, std::string &err);
+
+    bool run(const std::string &inputPath, const Options &o, std::ostream &log, std::string &err);
+};
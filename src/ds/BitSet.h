@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// index of the lowest set bit; x must be non-zero
+inline unsigned lowestSetBit(std::uint64_t x)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return (unsigned)idx;
+#else
+    return (unsigned)__builtin_ctzll(x);
+#endif
+}
+
+// index of the highest set bit; x must be non-zero
+inline unsigned highestSetBit(std::uint64_t x)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanReverse64(&idx, x);
+    return (unsigned)idx;
+#else
+    return 63u - (unsigned)__builtin_clzll(x);
+#endif
+}
+
+// Fixed-size bitset scanned a 64-bit word at a time.
+class BitSet
+{
+private:
+    std::uint64_t *w;
+    std::size_t nbits;
+    std::size_t nwords;
+
+public:
+    BitSet() : w(nullptr), nbits(0), nwords(0) {}
+    ~BitSet() { delete[] w; }
+
+    BitSet(const BitSet &) = delete;
+    BitSet &operator=(const BitSet &) = delete;
+
+    void init(std::size_t bits)
+    {
+        delete[] w;
+        nbits = bits;
+        nwords = (bits + 63) / 64;
+        w = nwords ? new std::uint64_t[nwords]() : nullptr;
+    }
+
+    std::size_t size() const { return nbits; }
+
+    // raw word access for bulk producers/consumers
+    std::size_t wordCount() const { return nwords; }
+    std::uint64_t *words() { return w; }
+    const std::uint64_t *words() const { return w; }
+
+    void set(std::size_t i) { w[i >> 6] |= (std::uint64_t(1) << (i & 63)); }
+    void reset(std::size_t i) { w[i >> 6] &= ~(std::uint64_t(1) << (i & 63)); }
+    void assign(std::size_t i, bool v) { v ? set(i) : reset(i); }
+    bool test(std::size_t i) const { return (w[i >> 6] >> (i & 63)) & 1u; }
+
+    // first set bit in [from, end), or end if none.
+    // Reads the live words, so bits set ahead of the cursor while iterating are seen.
+    std::size_t next(std::size_t from, std::size_t end) const
+    {
+        if (from >= end)
+            return end;
+        std::size_t wi = from >> 6;
+        std::uint64_t word = w[wi] & (~std::uint64_t(0) << (from & 63));
+        while (true)
+        {
+            if (word)
+            {
+                std::size_t i = (wi << 6) + lowestSetBit(word);
+                return (i < end) ? i : end;
+            }
+            if (++wi >= nwords || (wi << 6) >= end)
+                return end;
+            word = w[wi];
+        }
+    }
+};
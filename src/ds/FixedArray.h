@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Contiguous array of non-copyable objects, constructed in place once.
+// Capacity is fixed by init(); elements live until clear()/destruction.
+template <typename T>
+class FixedArray
+{
+private:
+    T *arr;
+    std::size_t cap;
+    std::size_t n;
+
+public:
+    FixedArray() : arr(nullptr), cap(0), n(0) {}
+    ~FixedArray() { clear(); }
+
+    FixedArray(const FixedArray &) = delete;
+    FixedArray &operator=(const FixedArray &) = delete;
+
+    void init(std::size_t capacity)
+    {
+        clear();
+        if (capacity == 0)
+            return;
+        arr = static_cast<T *>(::operator new(capacity * sizeof(T)));
+        cap = capacity;
+    }
+
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        T *slot = new (arr + n) T(std::forward<Args>(args)...);
+        ++n;
+        return *slot;
+    }
+
+    void clear()
+    {
+        for (std::size_t i = n; i > 0; --i)
+            arr[i - 1].~T();
+        ::operator delete(arr);
+        arr = nullptr;
+        cap = n = 0;
+    }
+
+    bool empty() const { return n == 0; }
+    std::size_t size() const { return n; }
+
+    T &operator[](std::size_t i) { return arr[i]; }
+    const T &operator[](std::size_t i) const { return arr[i]; }
+
+    T *begin() { return arr; }
+    T *end() { return arr + n; }
+    const T *begin() const { return arr; }
+    const T *end() const { return arr + n; }
+};
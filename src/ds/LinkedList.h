@@ -45,6 +45,31 @@ public:
         ++count;
     }
 
+    // insert after every element not greater than value (by less), so a
+    // list kept in order stays sorted and equal elements stay FIFO; O(1)
+    // when value belongs at the back
+    template <typename Less>
+    void insertSorted(const T &value, Less &&less)
+    {
+        if (!tail || !less(value, tail->data))
+        {
+            pushBack(value);
+            return;
+        }
+        if (less(value, head->data))
+        {
+            pushFront(value);
+            return;
+        }
+        Node<T> *prev = head;
+        while (!less(value, prev->next->data))
+            prev = prev->next;
+        Node<T> *n = new Node<T>(value);
+        n->next = prev->next;
+        prev->next = n;
+        ++count;
+    }
+
     // pops front into out; returns false if empty
     bool popFront(T &out)
     {
@@ -97,4 +122,14 @@ public:
         head = tail = nullptr;
         count = 0;
     }
+
+    // replace the contents with map(x) of o's elements, same order (for
+    // deep copies whose elements point into another structure)
+    template <typename F>
+    void copyFrom(const LinkedList &o, F &&map)
+    {
+        clear();
+        for (Node<T> *cur = o.head; cur; cur = cur->next)
+            pushBack(map(cur->data));
+    }
 };
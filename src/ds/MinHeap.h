@@ -75,6 +75,7 @@ public:
 
     bool empty() const { return n == 0; }
     std::size_t size() const { return n; }
+    void clear() { n = 0; }
 
     void push(const T &value)
     {
@@ -98,9 +99,42 @@ public:
         return root;
     }
 
+    // remove an arbitrary element (O(n) search); returns false if absent
+    bool remove(const T &value)
+    {
+        std::size_t i = 0;
+        while (i < n && !(arr[i] == value))
+            ++i;
+        if (i == n)
+            return false;
+        --n;
+        if (i < n)
+        {
+            arr[i] = arr[n];
+            heapifyDown(i);
+            heapifyUp(i);
+        }
+        return true;
+    }
+
     const T *raw() const { return arr; }
     std::size_t rawSize() const { return n; }
 
+    // replace the contents with map(x) of o's elements in o's array layout
+    // (map must keep the order)
+    template <typename F>
+    void copyFrom(const MinHeap &o, F &&map)
+    {
+        if (cap < o.n)
+        {
+            delete[] arr;
+            arr = new T[o.cap];
+            cap = o.cap;
+        }
+        for (n = 0; n < o.n; ++n)
+            arr[n] = map(o.arr[n]);
+    }
+
     T peek() const
     {
         if (n == 0)
@@ -15,6 +15,10 @@ public:
 
     void enqueue(const T &value) { list.pushBack(value); }
     bool dequeue(T &out) { return list.popFront(out); }
+    bool remove(const T &value) { return list.removeFirst(value); } // O(n)
 
     Node<T> *getHead() const { return list.getHead(); } // for printing
+
+    template <typename F>
+    void copyFrom(const Queue &o, F &&map) { list.copyFrom(o.list, map); }
 };
@@ -0,0 +1,398 @@
+#pragma once
+#include <cstddef>
+
+// Red-black tree ordered by a strict-weak "less" function (like MinHeap).
+// O(log n) insert/erase, O(1) access to the leftmost (minimum) element.
+// Equal keys are kept; a new equal key goes to the right of existing ones.
+template <typename T>
+class RBTree
+{
+public:
+    using LessFunc = bool (*)(const T &, const T &);
+
+    struct RBNode
+    {
+        T data;
+        RBNode *left;
+        RBNode *right;
+        RBNode *parent;
+        bool red;
+    };
+
+private:
+    RBNode *root;
+    RBNode *leftmost;
+    std::size_t n;
+    LessFunc less;
+
+    static RBNode *minimum(RBNode *x)
+    {
+        while (x->left)
+            x = x->left;
+        return x;
+    }
+
+    static RBNode *maximum(RBNode *x)
+    {
+        while (x->right)
+            x = x->right;
+        return x;
+    }
+
+    static bool isRed(const RBNode *x) { return x && x->red; }
+
+    void rotateLeft(RBNode *x)
+    {
+        RBNode *y = x->right;
+        x->right = y->left;
+        if (y->left)
+            y->left->parent = x;
+        y->parent = x->parent;
+        if (!x->parent)
+            root = y;
+        else if (x == x->parent->left)
+            x->parent->left = y;
+        else
+            x->parent->right = y;
+        y->left = x;
+        x->parent = y;
+    }
+
+    void rotateRight(RBNode *x)
+    {
+        RBNode *y = x->left;
+        x->left = y->right;
+        if (y->right)
+            y->right->parent = x;
+        y->parent = x->parent;
+        if (!x->parent)
+            root = y;
+        else if (x == x->parent->right)
+            x->parent->right = y;
+        else
+            x->parent->left = y;
+        y->right = x;
+        x->parent = y;
+    }
+
+    void transplant(RBNode *u, RBNode *v)
+    {
+        if (!u->parent)
+            root = v;
+        else if (u == u->parent->left)
+            u->parent->left = v;
+        else
+            u->parent->right = v;
+        if (v)
+            v->parent = u->parent;
+    }
+
+    void insertFixup(RBNode *z)
+    {
+        while (isRed(z->parent))
+        {
+            RBNode *p = z->parent;
+            RBNode *g = p->parent; // exists: a red node is never the root
+            if (p == g->left)
+            {
+                RBNode *u = g->right;
+                if (isRed(u))
+                {
+                    p->red = u->red = false;
+                    g->red = true;
+                    z = g;
+                }
+                else
+                {
+                    if (z == p->right)
+                    {
+                        z = p;
+                        rotateLeft(z);
+                        p = z->parent;
+                    }
+                    p->red = false;
+                    g->red = true;
+                    rotateRight(g);
+                }
+            }
+            else
+            {
+                RBNode *u = g->left;
+                if (isRed(u))
+                {
+                    p->red = u->red = false;
+                    g->red = true;
+                    z = g;
+                }
+                else
+                {
+                    if (z == p->left)
+                    {
+                        z = p;
+                        rotateRight(z);
+                        p = z->parent;
+                    }
+                    p->red = false;
+                    g->red = true;
+                    rotateLeft(g);
+                }
+            }
+        }
+        root->red = false;
+    }
+
+    // x may be null (a removed black leaf); parent tracks where it hangs
+    void eraseFixup(RBNode *x, RBNode *parent)
+    {
+        while (x != root && !isRed(x))
+        {
+            if (x == parent->left)
+            {
+                RBNode *w = parent->right;
+                if (isRed(w))
+                {
+                    w->red = false;
+                    parent->red = true;
+                    rotateLeft(parent);
+                    w = parent->right;
+                }
+                if (!isRed(w->left) && !isRed(w->right))
+                {
+                    w->red = true;
+                    x = parent;
+                    parent = x->parent;
+                }
+                else
+                {
+                    if (!isRed(w->right))
+                    {
+                        w->left->red = false;
+                        w->red = true;
+                        rotateRight(w);
+                        w = parent->right;
+                    }
+                    w->red = parent->red;
+                    parent->red = false;
+                    if (w->right)
+                        w->right->red = false;
+                    rotateLeft(parent);
+                    x = root;
+                }
+            }
+            else
+            {
+                RBNode *w = parent->left;
+                if (isRed(w))
+                {
+                    w->red = false;
+                    parent->red = true;
+                    rotateRight(parent);
+                    w = parent->left;
+                }
+                if (!isRed(w->left) && !isRed(w->right))
+                {
+                    w->red = true;
+                    x = parent;
+                    parent = x->parent;
+                }
+                else
+                {
+                    if (!isRed(w->left))
+                    {
+                        w->right->red = false;
+                        w->red = true;
+                        rotateLeft(w);
+                        w = parent->left;
+                    }
+                    w->red = parent->red;
+                    parent->red = false;
+                    if (w->left)
+                        w->left->red = false;
+                    rotateRight(parent);
+                    x = root;
+                }
+            }
+        }
+        if (x)
+            x->red = false;
+    }
+
+    static RBNode *successor(RBNode *x)
+    {
+        if (x->right)
+            return minimum(x->right);
+        RBNode *p = x->parent;
+        while (p && x == p->right)
+        {
+            x = p;
+            p = p->parent;
+        }
+        return p;
+    }
+
+    void destroy(RBNode *x)
+    {
+        while (x)
+        {
+            destroy(x->right);
+            RBNode *l = x->left;
+            delete x;
+            x = l;
+        }
+    }
+
+    template <typename F>
+    static RBNode *copyNodes(const RBNode *x, RBNode *parent, F &map)
+    {
+        if (!x)
+            return nullptr;
+        RBNode *c = new RBNode{map(x->data), nullptr, nullptr, parent, x->red};
+        c->left = copyNodes(x->left, c, map);
+        c->right = copyNodes(x->right, c, map);
+        return c;
+    }
+
+public:
+    RBTree(LessFunc lf) : root(nullptr), leftmost(nullptr), n(0), less(lf) {}
+    ~RBTree() { destroy(root); }
+
+    RBTree(const RBTree &) = delete;
+    RBTree &operator=(const RBTree &) = delete;
+
+    bool empty() const { return n == 0; }
+    std::size_t size() const { return n; }
+
+    RBNode *insert(const T &value)
+    {
+        RBNode *z = new RBNode{value, nullptr, nullptr, nullptr, true};
+        RBNode *y = nullptr;
+        RBNode *x = root;
+        bool isLeftmost = true;
+        while (x)
+        {
+            y = x;
+            if (less(value, x->data))
+                x = x->left;
+            else
+            {
+                x = x->right;
+                isLeftmost = false;
+            }
+        }
+        z->parent = y;
+        if (!y)
+            root = z;
+        else if (less(value, y->data))
+            y->left = z;
+        else
+            y->right = z;
+        if (isLeftmost)
+            leftmost = z;
+
+        insertFixup(z);
+        ++n;
+        return z;
+    }
+
+    void erase(RBNode *z)
+    {
+        if (z == leftmost)
+            leftmost = successor(z);
+
+        RBNode *y = z;
+        bool yWasRed = y->red;
+        RBNode *x = nullptr;
+        RBNode *xParent = nullptr;
+
+        if (!z->left)
+        {
+            x = z->right;
+            xParent = z->parent;
+            transplant(z, z->right);
+        }
+        else if (!z->right)
+        {
+            x = z->left;
+            xParent = z->parent;
+            transplant(z, z->left);
+        }
+        else
+        {
+            y = minimum(z->right);
+            yWasRed = y->red;
+            x = y->right;
+            if (y->parent == z)
+                xParent = y;
+            else
+            {
+                xParent = y->parent;
+                transplant(y, y->right);
+                y->right = z->right;
+                y->right->parent = y;
+            }
+            transplant(z, y);
+            y->left = z->left;
+            y->left->parent = y;
+            y->red = z->red;
+        }
+
+        delete z;
+        --n;
+        if (!yWasRed)
+            eraseFixup(x, xParent);
+    }
+
+    // the node holding `value` itself (operator==), not just an equal key:
+    // O(log n) plus the number of entries whose key equals value's
+    RBNode *find(const T &value) const
+    {
+        RBNode *first = nullptr; // leftmost node with an equal key
+        for (RBNode *x = root; x;)
+        {
+            if (less(x->data, value))
+                x = x->right;
+            else
+            {
+                if (!less(value, x->data))
+                    first = x;
+                x = x->left;
+            }
+        }
+        for (RBNode *x = first; x && !less(value, x->data); x = successor(x))
+            if (x->data == value)
+                return x;
+        return nullptr;
+    }
+
+    // O(1)
+    T peekMin() const { return leftmost ? leftmost->data : T{}; }
+
+    // O(log n)
+    T peekMax() const { return root ? maximum(root)->data : T{}; }
+
+    T popMin()
+    {
+        T v = leftmost->data;
+        erase(leftmost);
+        return v;
+    }
+
+    // replace the contents with map(x) of o's elements in o's exact shape
+    // (map must keep the order)
+    template <typename F>
+    void copyFrom(const RBTree &o, F &&map)
+    {
+        destroy(root);
+        root = copyNodes(o.root, nullptr, map);
+        leftmost = root ? minimum(root) : nullptr;
+        n = o.n;
+    }
+
+    // in-order (ascending) visit, for printing
+    template <typename F>
+    void forEachInOrder(F &&f) const
+    {
+        for (RBNode *x = leftmost; x; x = successor(x))
+            f(x->data);
+    }
+};
@@ -0,0 +1,207 @@
+#pragma once
+#include "MinHeap.h"
+#include "BitSet.h"
+#include <cstddef>
+#include <cstdint>
+
+// Monotone radix heap on unsigned 64-bit keys (equal keys allowed).
+// Bucket b > 0 holds keys whose highest bit differing from `last` is b-1;
+// bucket 0 holds the entries with the current minimum key `last`. Popping
+// the last of them redistributes the lowest non-empty bucket around that bucket's minimum,
+// and every key only ever moves to a lower bucket: O(log C) amortized per
+// key instead of a comparison heap's O(log n) pointer-chasing sift.
+// A key below the current minimum (non-monotone insert) goes to a small
+// binary heap that always holds keys below everything in the buckets.
+template <typename T>
+class RadixHeap
+{
+private:
+    static constexpr int BUCKETS = 65;
+
+    struct Entry
+    {
+        std::uint64_t key;
+        T value;
+        bool operator==(const Entry &o) const { return key == o.key && value == o.value; }
+    };
+
+    struct Bucket
+    {
+        Entry *arr = nullptr;
+        std::size_t n = 0;
+        std::size_t cap = 0;
+
+        void push(const Entry &e)
+        {
+            if (n == cap)
+            {
+                std::size_t newCap = (cap == 0) ? 8 : cap * 2;
+                Entry *newArr = new Entry[newCap];
+                for (std::size_t i = 0; i < n; ++i)
+                    newArr[i] = arr[i];
+                delete[] arr;
+                arr = newArr;
+                cap = newCap;
+            }
+            arr[n++] = e;
+        }
+    };
+
+    static bool lessEntry(const Entry &a, const Entry &b) { return a.key < b.key; }
+
+    Bucket buckets[BUCKETS];
+    std::uint64_t nonEmpty; // bit b set <=> bucket b (b < 64) non-empty
+    std::uint64_t last;     // key of the bucket-0 entry while the buckets are non-empty
+    std::size_t inBuckets;
+    MinHeap<Entry> below;   // keys below every bucket key
+    std::uint64_t belowMax; // largest key pushed to below since it was last empty
+
+    static int bucketOf(std::uint64_t key, std::uint64_t base)
+    {
+        std::uint64_t x = key ^ base;
+        return x ? (int)highestSetBit(x) + 1 : 0;
+    }
+
+    // bucket 64 has no bit: it is the lowest non-empty one when nonEmpty == 0
+    void mark(int b)
+    {
+        if (b < 64)
+            nonEmpty |= (std::uint64_t(1) << b);
+    }
+
+    void unmarkIfEmpty(int b)
+    {
+        if (b < 64 && buckets[b].n == 0)
+            nonEmpty &= ~(std::uint64_t(1) << b);
+    }
+
+    // bucket 0 was emptied: move the minimum-key entries of the lowest bucket into it
+    void normalize()
+    {
+        if (inBuckets == 0)
+            return;
+        int b = nonEmpty ? (int)lowestSetBit(nonEmpty) : 64;
+        Bucket &src = buckets[b];
+        std::uint64_t mn = src.arr[0].key;
+        for (std::size_t i = 1; i < src.n; ++i)
+            if (src.arr[i].key < mn)
+                mn = src.arr[i].key;
+        last = mn;
+
+        std::size_t cnt = src.n;
+        src.n = 0;
+        unmarkIfEmpty(b);
+        for (std::size_t i = 0; i < cnt; ++i)
+        {
+            int nb = bucketOf(src.arr[i].key, last);
+            buckets[nb].push(src.arr[i]);
+            mark(nb);
+        }
+    }
+
+public:
+    RadixHeap() : nonEmpty(0), last(0), inBuckets(0), below(&RadixHeap::lessEntry), belowMax(0) {}
+    ~RadixHeap()
+    {
+        for (Bucket &b : buckets)
+            delete[] b.arr;
+    }
+
+    RadixHeap(const RadixHeap &) = delete;
+    RadixHeap &operator=(const RadixHeap &) = delete;
+
+    bool empty() const { return size() == 0; }
+    std::size_t size() const { return inBuckets + below.size(); }
+
+    void push(std::uint64_t key, const T &value)
+    {
+        // empty buckets: any key above below's range can become the base
+        bool toBelow = (inBuckets == 0) ? (!below.empty() && key <= belowMax) : (key < last);
+        if (toBelow)
+        {
+            if (below.empty() || key > belowMax)
+                belowMax = key;
+            below.push(Entry{key, value});
+            return;
+        }
+        if (inBuckets == 0)
+            last = key;
+        int b = bucketOf(key, last);
+        buckets[b].push(Entry{key, value});
+        mark(b);
+        ++inBuckets;
+    }
+
+    T peek() const
+    {
+        if (!below.empty())
+            return below.peek().value;
+        return inBuckets ? buckets[0].arr[buckets[0].n - 1].value : T{};
+    }
+
+    T pop()
+    {
+        if (!below.empty())
+            return below.pop().value;
+        Bucket &min = buckets[0];
+        T v = min.arr[--min.n].value;
+        --inBuckets;
+        if (min.n == 0)
+        {
+            unmarkIfEmpty(0);
+            normalize();
+        }
+        return v;
+    }
+
+    // remove the entry (key, value) (O(bucket size)); false if absent
+    bool remove(std::uint64_t key, const T &value)
+    {
+        if (key >= last && inBuckets > 0)
+        {
+            int b = bucketOf(key, last);
+            Bucket &bk = buckets[b];
+            for (std::size_t i = 0; i < bk.n; ++i)
+            {
+                if (bk.arr[i].key != key || !(bk.arr[i].value == value))
+                    continue;
+                bk.arr[i] = bk.arr[--bk.n];
+                unmarkIfEmpty(b);
+                --inBuckets;
+                if (b == 0 && bk.n == 0)
+                    normalize();
+                return true;
+            }
+        }
+        return below.remove(Entry{key, value});
+    }
+
+    // replace the contents with (key, map(value)) of o's entries, same layout
+    template <typename F>
+    void copyFrom(const RadixHeap &o, F &&map)
+    {
+        for (int b = 0; b < BUCKETS; ++b)
+        {
+            buckets[b].n = 0;
+            for (std::size_t i = 0; i < o.buckets[b].n; ++i)
+                buckets[b].push(Entry{o.buckets[b].arr[i].key, map(o.buckets[b].arr[i].value)});
+        }
+        nonEmpty = o.nonEmpty;
+        last = o.last;
+        inBuckets = o.inBuckets;
+        below.copyFrom(o.below, [&](const Entry &e)
+                       { return Entry{e.key, map(e.value)}; });
+        belowMax = o.belowMax;
+    }
+
+    // unordered visit, for printing
+    template <typename F>
+    void forEach(F &&f) const
+    {
+        for (std::size_t i = 0; i < below.rawSize(); ++i)
+            f(below.raw()[i].value);
+        for (const Bucket &b : buckets)
+            for (std::size_t i = 0; i < b.n; ++i)
+                f(b.arr[i].value);
+    }
+};
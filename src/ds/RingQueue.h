@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+
+// FIFO on a growable circular buffer (power-of-two capacity):
+// O(1) push/pop without a node allocation per element.
+template <typename T>
+class RingQueue
+{
+private:
+    T *arr;
+    std::size_t cap;
+    std::size_t head;
+    std::size_t n;
+
+    void grow()
+    {
+        std::size_t newCap = (cap == 0) ? 8 : cap * 2;
+        T *newArr = new T[newCap];
+        for (std::size_t i = 0; i < n; ++i)
+            newArr[i] = arr[(head + i) & (cap - 1)];
+        delete[] arr;
+        arr = newArr;
+        cap = newCap;
+        head = 0;
+    }
+
+public:
+    RingQueue() : arr(nullptr), cap(0), head(0), n(0) {}
+    ~RingQueue() { delete[] arr; }
+
+    RingQueue(const RingQueue &) = delete;
+    RingQueue &operator=(const RingQueue &) = delete;
+
+    bool empty() const { return n == 0; }
+    std::size_t size() const { return n; }
+
+    void push(const T &value)
+    {
+        if (n == cap)
+            grow();
+        arr[(head + n) & (cap - 1)] = value;
+        ++n;
+    }
+
+    // pops front into out; returns false if empty
+    bool pop(T &out)
+    {
+        if (n == 0)
+            return false;
+        out = arr[head];
+        head = (head + 1) & (cap - 1);
+        --n;
+        return true;
+    }
+
+    // remove first occurrence, keeping FIFO order (O(n)); false if absent
+    bool remove(const T &value)
+    {
+        std::size_t i = 0;
+        while (i < n && !(arr[(head + i) & (cap - 1)] == value))
+            ++i;
+        if (i == n)
+            return false;
+        for (; i + 1 < n; ++i)
+            arr[(head + i) & (cap - 1)] = arr[(head + i + 1) & (cap - 1)];
+        --n;
+        return true;
+    }
+
+    T front() const { return n ? arr[head] : T{}; }
+
+    // i-th element from the front (for printing)
+    const T &at(std::size_t i) const { return arr[(head + i) & (cap - 1)]; }
+
+    // replace the contents with map(x) of o's elements, same order
+    template <typename F>
+    void copyFrom(const RingQueue &o, F &&map)
+    {
+        head = n = 0;
+        for (std::size_t i = 0; i < o.n; ++i)
+            push(map(o.at(i)));
+    }
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+// Lock-free ring for exactly one producer thread and one consumer thread
+// (fixed power-of-two capacity, trivially copyable T). Each side owns one
+// index and only reads the other's; writes are published with release and
+// observed with acquire, so the elements a read returns are complete.
+// Both calls move as many elements as fit and never block: the caller
+// decides how to wait (backpressure on a full ring, idling on an empty one).
+template <typename T>
+class SpscRing
+{
+private:
+    T *buf;
+    std::size_t cap;
+    alignas(64) std::atomic<std::size_t> head; // next read, advanced by the consumer
+    alignas(64) std::atomic<std::size_t> tail; // next write, advanced by the producer
+
+public:
+    explicit SpscRing(std::size_t minCapacity) : head(0), tail(0)
+    {
+        cap = 1;
+        while (cap < minCapacity)
+            cap <<= 1;
+        buf = new T[cap];
+    }
+    ~SpscRing() { delete[] buf; }
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    std::size_t capacity() const { return cap; }
+
+    // producer: copies up to n elements, returns how many
+    std::size_t write(const T *src, std::size_t n)
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t free = cap - (t - head.load(std::memory_order_acquire));
+        if (n > free)
+            n = free;
+        std::size_t at = t & (cap - 1);
+        std::size_t first = (n < cap - at) ? n : cap - at;
+        std::memcpy(buf + at, src, first * sizeof(T));
+        std::memcpy(buf, src + first, (n - first) * sizeof(T));
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    // consumer: copies up to n elements, returns how many
+    std::size_t read(T *dst, std::size_t n)
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        std::size_t avail = tail.load(std::memory_order_acquire) - h;
+        if (n > avail)
+            n = avail;
+        std::size_t at = h & (cap - 1);
+        std::size_t first = (n < cap - at) ? n : cap - at;
+        std::memcpy(dst, buf + at, first * sizeof(T));
+        std::memcpy(dst + first, buf, (n - first) * sizeof(T));
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+};
@@ -0,0 +1,110 @@
+#pragma once
+#include "LinkedList.h"
+#include <cstddef>
+
+// Hierarchical timing wheel: LEVELS wheels of 64 slots, each slot of level L
+// spanning 64^L ticks. schedule() is O(1); advance() touches one level-0
+// slot per tick and re-distributes a higher-level slot only when the lower
+// wheel wraps. Timers beyond 64^LEVELS ticks wait in an overflow list.
+template <typename T>
+class TimingWheel
+{
+private:
+    static constexpr int BITS = 6;
+    static constexpr int SLOTS = 1 << BITS;
+    static constexpr long long MASK = SLOTS - 1;
+    static constexpr int LEVELS = 4;
+
+    struct Entry
+    {
+        long long when;
+        T item;
+    };
+
+    LinkedList<Entry> slots[LEVELS][SLOTS];
+    LinkedList<Entry> overflow;
+    long long now; // next tick to be processed by advance()
+    std::size_t n;
+
+    void place(Entry e)
+    {
+        if (e.when < now)
+            e.when = now; // already due
+        long long d = e.when - now;
+        for (int lvl = 0; lvl < LEVELS; ++lvl)
+        {
+            if (d < (1LL << (BITS * (lvl + 1))))
+            {
+                slots[lvl][(e.when >> (BITS * lvl)) & MASK].pushBack(e);
+                return;
+            }
+        }
+        overflow.pushBack(e);
+    }
+
+    void redistribute(LinkedList<Entry> &list)
+    {
+        Entry e;
+        LinkedList<Entry> tmp;
+        while (list.popFront(e))
+            tmp.pushBack(e);
+        while (tmp.popFront(e))
+            place(e);
+    }
+
+public:
+    TimingWheel() : now(0), n(0) {}
+
+    TimingWheel(const TimingWheel &) = delete;
+    TimingWheel &operator=(const TimingWheel &) = delete;
+
+    bool empty() const { return n == 0; }
+    std::size_t size() const { return n; }
+
+    void schedule(long long when, const T &item)
+    {
+        place(Entry{when, item});
+        ++n;
+    }
+
+    // replace the timers with (when, map(item)) of o's, same slots
+    template <typename F>
+    void copyFrom(const TimingWheel &o, F &&map)
+    {
+        auto entry = [&](const Entry &e)
+        { return Entry{e.when, map(e.item)}; };
+        for (int lvl = 0; lvl < LEVELS; ++lvl)
+            for (int s = 0; s < SLOTS; ++s)
+                slots[lvl][s].copyFrom(o.slots[lvl][s], entry);
+        overflow.copyFrom(o.overflow, entry);
+        now = o.now;
+        n = o.n;
+    }
+
+    // processes every tick up to and including t, appending due items to out
+    void advance(long long t, LinkedList<T> &out)
+    {
+        for (; now <= t; ++now)
+        {
+            if (now != 0 && (now & MASK) == 0)
+            {
+                if ((now & ((1LL << (BITS * LEVELS)) - 1)) == 0)
+                    redistribute(overflow);
+                // higher levels first, so their entries can cascade further down
+                for (int lvl = LEVELS - 1; lvl >= 1; --lvl)
+                {
+                    if ((now & ((1LL << (BITS * lvl)) - 1)) == 0)
+                        redistribute(slots[lvl][(now >> (BITS * lvl)) & MASK]);
+                }
+            }
+
+            LinkedList<Entry> &due = slots[0][now & MASK];
+            Entry e;
+            while (due.popFront(e))
+            {
+                out.pushBack(e.item);
+                --n;
+            }
+        }
+    }
+};
@@ -1,8 +1,13 @@
 #include "io/InputParser.h"
+#include "core/TaskGenerator.h"
+#include "core/TickKernel.h"
+#include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
 #include <vector>
 #include <cctype>
+#include <climits>
 #include <algorithm>
 
 static std::string stripComments(const std::string &line)
@@ -108,7 +113,7 @@ static bool isBlank(const std::string &s)
     return true;
 }
 
-static bool parsePairToken(const std::string &tok, int &r, int &d)
+static bool parsePairToken(const std::string &tok, long long &r, long long &d)
 {
     // tok = "(3,2)" possibly with spaces removed already
     if (tok.size() < 5)
@@ -119,8 +124,8 @@ static bool parsePairToken(const std::string &tok, int &r, int &d)
     std::size_t comma = mid.find(',');
     if (comma == std::string::npos)
         return false;
-    r = std::stoi(mid.substr(0, comma));
-    d = std::stoi(mid.substr(comma + 1));
+    r = std::stoll(mid.substr(0, comma));
+    d = std::stoll(mid.substr(comma + 1));
     return true;
 }
 
@@ -141,6 +146,379 @@ static bool isIntToken(const std::string &tok)
     return true;
 }
 
+// processor type names and counts in global processor order (ProcType order)
+static const int TYPE_COUNT = 7;
+static const char *const TYPE_NAMES[TYPE_COUNT] = {"FCFS", "SJF", "RR", "EDF", "MLFQ", "CFS", "LLF"};
+
+static int typeIndex(const std::string &name)
+{
+    for (int i = 0; i < TYPE_COUNT; ++i)
+        if (name == TYPE_NAMES[i])
+            return i;
+    return -1;
+}
+
+static bool parseDouble(const std::string &s, double &v)
+{
+    char *end = nullptr;
+    v = std::strtod(s.c_str(), &end);
+    return end != s.c_str() && *end == '\0';
+}
+
+// SPEED s0 s1 ... (one per processor, global order)
+// SPEED TYPE=s ...  (per type, unlisted types stay 1.0)
+static bool parseSpeeds(std::stringstream &ss, ParsedInput &out, std::string &err)
+{
+    const int counts[TYPE_COUNT] = {out.NF, out.NS, out.NR, out.NE, out.NM, out.NC, out.NL};
+
+    int total = 0;
+    for (int c : counts)
+        total += c;
+    out.speeds.assign((std::size_t)total, SPEED_ONE);
+
+    auto toFixed = [&](const std::string &s, int &v) -> bool
+    {
+        double d = 0;
+        if (!parseDouble(s, d))
+            return false;
+        v = (int)std::lround(d * SPEED_ONE);
+        return v >= 1 && v <= SPEED_MAX;
+    };
+
+    std::string tok;
+    int idx = 0;
+    bool perType = false;
+    while (ss >> tok)
+    {
+        std::size_t eq = tok.find('=');
+        int v = 0;
+        if (eq == std::string::npos)
+        {
+            if (perType || idx >= total || !toFixed(tok, v))
+            {
+                err = "Bad SPEED value " + tok;
+                return false;
+            }
+            out.speeds[(std::size_t)idx++] = v;
+            continue;
+        }
+
+        perType = true;
+        int tp = typeIndex(tok.substr(0, eq));
+        if (tp < 0 || idx > 0 || !toFixed(tok.substr(eq + 1), v))
+        {
+            err = "Bad SPEED entry " + tok;
+            return false;
+        }
+        int base = 0;
+        for (int i = 0; i < tp; ++i)
+            base += counts[i];
+        for (int i = 0; i < counts[tp]; ++i)
+            out.speeds[(std::size_t)(base + i)] = v;
+    }
+    if (!perType && idx != total)
+    {
+        err = "SPEED needs one value per processor (or TYPE=value entries)";
+        return false;
+    }
+    return true;
+}
+
+// POWER THRESHOLD WAKEUP BUSY IDLE SLEEP [TYPE=BUSY,IDLE,SLEEP ...]
+static bool parsePower(std::stringstream &ss, ParsedInput &out, std::string &err)
+{
+    double busy = 0, idle = 0, sleep = 0;
+    if (!(ss >> out.idleThreshold >> out.wakeLatency >> busy >> idle >> sleep) ||
+        out.idleThreshold < 0 || out.wakeLatency < 0 || busy < 0 || idle < 0 || sleep < 0)
+    {
+        err = "Bad POWER line (THRESHOLD WAKEUP BUSY IDLE SLEEP, all >= 0)";
+        return false;
+    }
+    out.powerEnabled = true;
+    out.powerBusy.assign(TYPE_COUNT, busy);
+    out.powerIdle.assign(TYPE_COUNT, idle);
+    out.powerSleep.assign(TYPE_COUNT, sleep);
+
+    std::string tok;
+    while (ss >> tok)
+    {
+        std::size_t eq = tok.find('=');
+        int tp = (eq == std::string::npos) ? -1 : typeIndex(tok.substr(0, eq));
+        std::string vals = (tp < 0) ? "" : tok.substr(eq + 1);
+        std::size_t c1 = vals.find(',');
+        std::size_t c2 = (c1 == std::string::npos) ? c1 : vals.find(',', c1 + 1);
+        if (tp < 0 || c2 == std::string::npos ||
+            !parseDouble(vals.substr(0, c1), busy) ||
+            !parseDouble(vals.substr(c1 + 1, c2 - c1 - 1), idle) ||
+            !parseDouble(vals.substr(c2 + 1), sleep) || busy < 0 || idle < 0 || sleep < 0)
+        {
+            err = "Bad POWER entry (TYPE=BUSY,IDLE,SLEEP) " + tok;
+            return false;
+        }
+        out.powerBusy[tp] = busy;
+        out.powerIdle[tp] = idle;
+        out.powerSleep[tp] = sleep;
+    }
+    return true;
+}
+
+Process *InputParser::parseProcessLine(const std::string &line, std::string &err)
+{
+    std::stringstream ss(line);
+
+    long long AT = 0, CT = 0;
+    int PID = 0;
+    if (!(ss >> AT >> PID >> CT))
+    {
+        err = "Bad process line (AT PID CT missing): " + line;
+        return nullptr;
+    }
+
+    std::vector<long long> ints;
+    std::vector<std::pair<long long, long long>> pairs;
+
+    std::string tok;
+    while (ss >> tok)
+    {
+        if (!tok.empty() && tok.front() == '(')
+        {
+            long long r = 0, d = 0;
+            if (!parsePairToken(tok, r, d))
+            {
+                err = "Bad IO pair token: " + tok + " in line: " + line;
+                return nullptr;
+            }
+            pairs.push_back({r, d});
+        }
+        else if (isIntToken(tok))
+        {
+            ints.push_back(std::stoll(tok));
+        }
+        else
+        {
+            err = "Unknown token: " + tok + " in line: " + line;
+            return nullptr;
+        }
+    }
+
+    long long DL = -1;
+    long long ioCount = 0;
+    long long weight = 1;
+
+    // Backward compatible:
+    // old:  AT PID CT IOcount (...)
+    // new:  AT PID CT DL IOcount (...)
+    // CFS:  AT PID CT DL IOcount (...) WEIGHT
+    if (ints.size() == 1)
+    {
+        ioCount = ints[0];
+    }
+    else if (ints.size() == 2)
+    {
+        DL = ints[0];
+        ioCount = ints[1];
+    }
+    else if (ints.size() == 3)
+    {
+        DL = ints[0];
+        ioCount = ints[1];
+        weight = ints[2];
+        if (weight <= 0)
+        {
+            err = "Bad process weight (must be > 0): " + line;
+            return nullptr;
+        }
+    }
+    else
+    {
+        err = "Bad process line: expected IOcount, DL IOcount or DL IOcount ... WEIGHT: " + line;
+        return nullptr;
+    }
+
+    if ((long long)pairs.size() != ioCount)
+    {
+        err = "IOcount mismatch in line: " + line;
+        return nullptr;
+    }
+
+    // times are 64-bit, but a job's CT and IO pairs must fit the tick kernel's int lanes
+    bool fits = CT <= INT_MAX && weight <= INT_MAX;
+    for (const auto &pr : pairs)
+        fits = fits && pr.first <= INT_MAX && pr.second <= INT_MAX;
+    if (!fits)
+    {
+        err = "CT / IO_R / IO_D / WEIGHT above 2147483647 in line: " + line;
+        return nullptr;
+    }
+
+    // ---- Build IO array (adjust struct name/fields if needed) ----
+    IORequest *ioArr = nullptr;
+    if (ioCount > 0)
+    {
+        ioArr = new IORequest[ioCount];
+        for (int k = 0; k < ioCount; ++k)
+        {
+            ioArr[k].io_r = (int)pairs[k].first;
+            ioArr[k].io_d = (int)pairs[k].second;
+        }
+    }
+
+    Process *p = new Process(PID, AT, (int)CT, (int)ioCount, ioArr);
+
+    // ✅ EDF: store absolute deadline if present
+    if (DL >= 0)
+        p->setDeadline(DL);
+    p->setWeight((int)weight);
+    return p;
+}
+
+// field checks shared by task lines and in-memory task specs
+static bool checkTask(const TaskSpec &t, std::string &err)
+{
+    if (t.pid < 0 || t.CT <= 0 || t.period <= 0)
+    {
+        err = t.sporadic ? "needs pid >= 0, min > 0 and ct > 0" : "needs pid >= 0, period > 0 and ct > 0";
+        return false;
+    }
+    if (t.offset < 0 || t.jitter < 0 || t.DL < -1 || t.DL == 0 || t.weight <= 0)
+    {
+        err = "needs offset, jitter >= 0 and dl, weight > 0";
+        return false;
+    }
+    bool bounded = t.count > 0 || t.until > t.offset;
+    if (!bounded || t.count == 0 || t.count < -1 || (t.until != -1 && t.until <= t.offset))
+    {
+        err = "needs count > 0 or until > offset";
+        return false;
+    }
+    // job PIDs pid .. pid + jobs - 1 must fit in an int
+    if (TaskGenerator::jobBound(t) - 1 > INT_MAX - t.pid)
+    {
+        err = "job PIDs exceed 2147483647";
+        return false;
+    }
+    return true;
+}
+
+// every task's job PIDs (pid .. pid + jobBound - 1) must be free: not an
+// explicit process's PID and not in another task's range
+static bool checkTaskPids(const std::vector<TaskSpec> &tasks, const LinkedList<Process *> &procs,
+                          std::string &err)
+{
+    if (tasks.empty())
+        return true;
+    std::vector<std::pair<long long, long long>> ranges; // first, last PID
+    for (const TaskSpec &t : tasks)
+        ranges.push_back({t.pid, t.pid + TaskGenerator::jobBound(t) - 1});
+    std::sort(ranges.begin(), ranges.end());
+    for (std::size_t i = 1; i < ranges.size(); ++i)
+        if (ranges[i].first <= ranges[i - 1].second)
+        {
+            err = "Task job PIDs overlap: " + std::to_string(ranges[i - 1].first) + ".." +
+                  std::to_string(ranges[i - 1].second) + " and " + std::to_string(ranges[i].first) + ".." +
+                  std::to_string(ranges[i].second);
+            return false;
+        }
+    for (Node<Process *> *n = procs.getHead(); n; n = n->next)
+    {
+        long long pid = n->data->getPID();
+        auto it = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(pid, LLONG_MAX));
+        if (it != ranges.begin() && pid <= std::prev(it)->second)
+        {
+            err = "Process PID " + std::to_string(pid) + " is in the job PID range " +
+                  std::to_string(std::prev(it)->first) + ".." + std::to_string(std::prev(it)->second) +
+                  " of a task";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool InputParser::isTaskLine(const std::string &line)
+{
+    std::stringstream ss(line);
+    std::string word;
+    return (ss >> word) && (word == "PERIODIC" || word == "SPORADIC");
+}
+
+// PERIODIC pid=P period=T ct=C [offset=O] [dl=D] [weight=W] [(IO_R,IO_D)...] count=N|until=U
+// SPORADIC pid=P min=T [jitter=J] [seed=S] ct=C ... (same as PERIODIC)
+bool InputParser::parseTaskLine(const std::string &line, TaskSpec &out, std::string &err)
+{
+    std::stringstream ss(line);
+    std::string kind;
+    ss >> kind;
+    out = TaskSpec{};
+    out.sporadic = (kind == "SPORADIC");
+
+    long long pid = -1, ct = -1, weight = 1;
+    std::string tok;
+    while (ss >> tok)
+    {
+        if (tok.front() == '(')
+        {
+            long long r = 0, d = 0;
+            if (!parsePairToken(tok, r, d) || r < 0 || d < 0 || r > INT_MAX || d > INT_MAX)
+            {
+                err = "Bad IO pair token: " + tok + " in line: " + line;
+                return false;
+            }
+            out.io.push_back(IORequest{(int)r, (int)d});
+            continue;
+        }
+
+        std::size_t eq = tok.find('=');
+        std::string key = tok.substr(0, eq);
+        std::string val = (eq == std::string::npos) ? "" : tok.substr(eq + 1);
+        if (!isIntToken(val) || val.size() > 19)
+        {
+            err = "Bad " + kind + " field: " + tok + " in line: " + line;
+            return false;
+        }
+        long long v = std::stoll(val);
+        if (key == "pid")
+            pid = v;
+        else if (key == (out.sporadic ? "min" : "period"))
+            out.period = v;
+        else if (key == "offset")
+            out.offset = v;
+        else if (key == "ct")
+            ct = v;
+        else if (key == "dl")
+            out.DL = v;
+        else if (key == "weight")
+            weight = v;
+        else if (key == "count")
+            out.count = v;
+        else if (key == "until")
+            out.until = v;
+        else if (out.sporadic && key == "jitter")
+            out.jitter = v;
+        else if (out.sporadic && key == "seed")
+            out.seed = (std::uint64_t)v;
+        else
+        {
+            err = "Unknown " + kind + " field: " + tok + " in line: " + line;
+            return false;
+        }
+    }
+
+    if (pid < INT_MIN || pid > INT_MAX || ct < INT_MIN || ct > INT_MAX || weight < INT_MIN || weight > INT_MAX)
+    {
+        err = kind + " pid / ct / weight above 2147483647: " + line;
+        return false;
+    }
+    out.pid = (int)pid;
+    out.CT = (int)ct;
+    out.weight = (int)weight;
+    if (!checkTask(out, err))
+    {
+        err = kind + " " + err + ": " + line;
+        return false;
+    }
+    return true;
+}
+
 bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::string &err)
 {
     err.clear();
@@ -152,9 +530,20 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
         return false;
     }
 
-    out.NF = out.NS = out.NR = 0;
+    out.NF = out.NS = out.NR = out.NE = out.NM = out.NC = out.NL = 0;
+    out.cfsLatency = out.cfsMinGran = 0;
+    out.llfHysteresis = 0;
     out.timeSlice = 0;
+    out.mlfqLevels = out.mlfqBoost = 0;
+    out.mlfqQuanta.clear();
+    out.speeds.clear();
+    out.powerEnabled = false;
+    out.idleThreshold = out.wakeLatency = 0;
+    out.powerBusy.clear();
+    out.powerIdle.clear();
+    out.powerSleep.clear();
     out.RTF = out.MaxW = out.STL = out.forkProb = 0;
+    out.tasks.clear();
     out.M = 0;
 
     while (out.newList.getHead())
@@ -202,6 +591,18 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
             err = "Bad NF NS NR NE line: " + line;
             return false;
         }
+        // optional: NM NC NL
+        if (!(ss >> out.NM))
+            out.NM = 0;
+        else if (!(ss >> out.NC))
+            out.NC = 0;
+        else if (!(ss >> out.NL))
+            out.NL = 0;
+        if (out.NF < 0 || out.NS < 0 || out.NR < 0 || out.NE < 0 || out.NM < 0 || out.NC < 0 || out.NL < 0)
+        {
+            err = "Bad processor counts (negative): " + line;
+            return false;
+        }
     }
 
     // ---- RR time slice ----
@@ -219,12 +620,103 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
         }
     }
 
-    // ---- RTF MaxW STL ForkProb ----
+    // ---- MLFQ config (only when NM > 0): LEVELS BOOST q0 q1 ... ----
+    if (out.NM > 0)
+    {
+        if (!readNextDataLine(line))
+        {
+            err = "Missing MLFQ config line";
+            return false;
+        }
+        std::stringstream ss(line);
+        if (!(ss >> out.mlfqLevels >> out.mlfqBoost))
+        {
+            err = "Bad MLFQ config line (LEVELS BOOST q0 q1 ...): " + line;
+            return false;
+        }
+        if (out.mlfqLevels < 1 || out.mlfqLevels > 64 || out.mlfqBoost < 0)
+        {
+            err = "Bad MLFQ config (1 <= LEVELS <= 64, BOOST >= 0): " + line;
+            return false;
+        }
+        int q = 0;
+        while (ss >> q)
+        {
+            if (q <= 0)
+            {
+                err = "Bad MLFQ quantum (must be > 0): " + line;
+                return false;
+            }
+            out.mlfqQuanta.push_back(q);
+        }
+        if ((int)out.mlfqQuanta.size() != out.mlfqLevels)
+        {
+            err = "MLFQ quanta count must equal LEVELS: " + line;
+            return false;
+        }
+    }
+
+    // ---- CFS config (only when NC > 0): LATENCY MIN_GRAN ----
+    if (out.NC > 0)
+    {
+        if (!readNextDataLine(line))
+        {
+            err = "Missing CFS config line";
+            return false;
+        }
+        std::stringstream ss(line);
+        if (!(ss >> out.cfsLatency >> out.cfsMinGran) || out.cfsLatency <= 0 || out.cfsMinGran <= 0)
+        {
+            err = "Bad CFS config line (LATENCY MIN_GRAN, both > 0): " + line;
+            return false;
+        }
+    }
+
+    // ---- LLF config (only when NL > 0): HYSTERESIS ----
+    if (out.NL > 0)
+    {
+        if (!readNextDataLine(line))
+        {
+            err = "Missing LLF config line";
+            return false;
+        }
+        std::stringstream ss(line);
+        if (!(ss >> out.llfHysteresis) || out.llfHysteresis < 0)
+        {
+            err = "Bad LLF config line (HYSTERESIS >= 0): " + line;
+            return false;
+        }
+    }
+
+    // ---- optional SPEED / POWER lines, then RTF MaxW STL ForkProb ----
     if (!readNextDataLine(line))
     {
         err = "Missing RTF MaxW STL ForkProb line";
         return false;
     }
+    while (true)
+    {
+        std::stringstream ss(line);
+        std::string kw;
+        ss >> kw;
+        bool ok = true;
+        if (kw == "SPEED")
+            ok = parseSpeeds(ss, out, err);
+        else if (kw == "POWER")
+            ok = parsePower(ss, out, err);
+        else
+            break;
+        if (!ok)
+        {
+            err += ": " + line;
+            return false;
+        }
+        if (!readNextDataLine(line))
+        {
+            err = "Missing RTF MaxW STL ForkProb line";
+            return false;
+        }
+    }
     {
         std::stringstream ss(line);
         if (!(ss >> out.RTF >> out.MaxW >> out.STL >> out.forkProb))
@@ -254,7 +746,16 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
         }
     }
 
-    // ---- Processes ----
+    // ---- Processes (PERIODIC / SPORADIC lines anywhere from here on) ----
+    auto readTask = [&](const std::string &taskLine) -> bool
+    {
+        TaskSpec ts;
+        if (!parseTaskLine(taskLine, ts, err))
+            return false;
+        out.tasks.push_back(ts);
+        return true;
+    };
+
     std::vector<Process *> procVec;
     procVec.reserve((size_t)out.M);
 
@@ -267,94 +768,318 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
             return false;
         }
 
-        std::stringstream ss(line);
+        // task lines do not count towards M
+        if (isTaskLine(line))
+        {
+            if (!readTask(line))
+                return false;
+            continue;
+        }
+
+        Process *p = parseProcessLine(line, err);
+        if (!p)
+            return false;
+
+        out.allProcesses.pushBack(p);
+        procVec.push_back(p);
 
-        int AT = 0, PID = 0, CT = 0;
-        if (!(ss >> AT >> PID >> CT))
+        ++readCount;
+    }
+
+    // Ensure NEW list is sorted by AT (and PID tie-break)
+    std::sort(procVec.begin(), procVec.end(),
+              [](Process *a, Process *b)
+              {
+                  if (a->getAT() != b->getAT())
+                      return a->getAT() < b->getAT();
+                  return a->getPID() < b->getPID();
+              });
+
+    for (Process *p : procVec)
+        out.newList.pushBack(p);
+
+    // ---- Kill events until EOF ----
+    std::vector<KillEvent> kills;
+    while (readNextDataLine(line))
+    {
+        if (isTaskLine(line))
         {
-            err = "Bad process line (AT PID CT missing): " + line;
+            if (!readTask(line))
+                return false;
+            continue;
+        }
+
+        std::stringstream ss(line);
+        KillEvent k;
+        if (!(ss >> k.time >> k.pid))
+        {
+            err = "Bad kill event line: " + line;
             return false;
         }
+        kills.push_back(k);
+    }
+
+    if (!checkTaskPids(out.tasks, out.allProcesses, err))
+        return false;
+
+    std::sort(kills.begin(), kills.end(),
+              [](const KillEvent &a, const KillEvent &b)
+              {
+                  if (a.time != b.time)
+                      return a.time < b.time;
+                  return a.pid < b.pid;
+              });
+
+    for (auto &k : kills)
+        out.killEvents.pushBack(k);
+
+    return true;
+}
+
+bool InputParser::parseCluster(const std::string &path, ClusterInput &out, std::string &err)
+{
+    err.clear();
 
-        std::vector<int> ints;
-        std::vector<std::pair<int, int>> pairs;
+    std::ifstream fin(path);
+    if (!fin)
+    {
+        err = "Cannot open cluster file: " + path;
+        return false;
+    }
 
-        std::string tok;
-        while (ss >> tok)
+    auto readNextDataLine = [&](std::string &lineOut) -> bool
+    {
+        std::string line;
+        while (std::getline(fin, line))
         {
-            if (!tok.empty() && tok.front() == '(')
-            {
-                int r = 0, d = 0;
-                if (!parsePairToken(tok, r, d))
-                {
-                    err = "Bad IO pair token: " + tok + " in line: " + line;
-                    return false;
-                }
-                pairs.push_back({r, d});
-            }
-            else if (isIntToken(tok))
-            {
-                ints.push_back(std::stoi(tok));
-            }
-            else
-            {
-                err = "Unknown token: " + tok + " in line: " + line;
-                return false;
-            }
+            line = stripComment(line);
+            if (isBlank(line))
+                continue;
+            lineOut = line;
+            return true;
         }
+        return false;
+    };
 
-        int DL = -1;
-        int ioCount = 0;
+    std::string line;
 
-        // Backward compatible:
-        // old:  AT PID CT IOcount (...)
-        // new:  AT PID CT DL IOcount (...)
-        if (ints.size() == 1)
+    // ---- NODES POLICY DELAY ----
+    int nodes = 0;
+    std::string policy;
+    if (!readNextDataLine(line))
+    {
+        err = "Missing NODES POLICY DELAY line";
+        return false;
+    }
+    {
+        std::stringstream ss(line);
+        if (!(ss >> nodes >> policy >> out.netDelay) || nodes <= 0 || out.netDelay < 0)
         {
-            ioCount = ints[0];
+            err = "Bad NODES POLICY DELAY line: " + line;
+            return false;
         }
-        else if (ints.size() == 2)
+    }
+    if (policy == "rr")
+        out.policy = RoutePolicy::RoundRobin;
+    else if (policy == "eft")
+        out.policy = RoutePolicy::LeastEFT;
+    else if (policy == "p2c")
+        out.policy = RoutePolicy::PowerOfTwo;
+    else
+    {
+        err = "Unknown routing policy (rr|eft|p2c): " + policy;
+        return false;
+    }
+
+    // ---- one node input file per line ----
+    out.nodeFiles.clear();
+    for (int i = 0; i < nodes; ++i)
+    {
+        if (!readNextDataLine(line))
         {
-            DL = ints[0];
-            ioCount = ints[1];
+            err = "Missing node input file " + std::to_string(i);
+            return false;
         }
-        else
+        std::stringstream ss(line);
+        std::string file;
+        ss >> file;
+        out.nodeFiles.push_back(file);
+    }
+
+    // ---- shared workload ----
+    if (!readNextDataLine(line))
+    {
+        err = "Missing workload M line";
+        return false;
+    }
+    {
+        std::stringstream ss(line);
+        if (!(ss >> out.M) || out.M < 0)
         {
-            err = "Bad process line: expected IOcount or DL IOcount: " + line;
+            err = "Bad workload M line: " + line;
             return false;
         }
+    }
+
+    std::vector<Process *> procVec;
+    procVec.reserve((size_t)out.M);
+    bool ok = true;
+    for (int i = 0; i < out.M; ++i)
+    {
+        if (!readNextDataLine(line))
+        {
+            err = "Unexpected EOF while reading workload";
+            ok = false;
+            break;
+        }
+        Process *p = parseProcessLine(line, err);
+        if (!p)
+        {
+            ok = false;
+            break;
+        }
+        procVec.push_back(p);
+    }
+    if (!ok)
+    {
+        for (Process *p : procVec)
+            delete p;
+        return false;
+    }
+
+    std::sort(procVec.begin(), procVec.end(),
+              [](Process *a, Process *b)
+              {
+                  if (a->getAT() != b->getAT())
+                      return a->getAT() < b->getAT();
+                  return a->getPID() < b->getPID();
+              });
+
+    for (Process *p : procVec)
+        out.workload.pushBack(p);
 
-        if ((int)pairs.size() != ioCount)
+    return true;
+}
+
+bool InputParser::build(const SimConfig &cfg,
+                        const ProcessSpec *procs, int n,
+                        const KillEvent *kills, int nk,
+                        ParsedInput &out, std::string &err)
+{
+    err.clear();
+
+    const int counts[TYPE_COUNT] = {cfg.NF, cfg.NS, cfg.NR, cfg.NE, cfg.NM, cfg.NC, cfg.NL};
+    int total = 0;
+    for (int c : counts)
+    {
+        if (c < 0)
+        {
+            err = "Bad processor counts (negative)";
+            return false;
+        }
+        total += c;
+    }
+    if (cfg.NM > 0)
+    {
+        if (cfg.mlfqLevels < 1 || cfg.mlfqLevels > 64 || cfg.mlfqBoost < 0)
+        {
+            err = "Bad MLFQ config (1 <= LEVELS <= 64, BOOST >= 0)";
+            return false;
+        }
+        if ((int)cfg.mlfqQuanta.size() != cfg.mlfqLevels)
+        {
+            err = "MLFQ quanta count must equal LEVELS";
+            return false;
+        }
+        for (int q : cfg.mlfqQuanta)
+            if (q <= 0)
+            {
+                err = "Bad MLFQ quantum (must be > 0)";
+                return false;
+            }
+    }
+    if (cfg.NC > 0 && (cfg.cfsLatency <= 0 || cfg.cfsMinGran <= 0))
+    {
+        err = "Bad CFS config (LATENCY MIN_GRAN, both > 0)";
+        return false;
+    }
+    if (cfg.NL > 0 && cfg.llfHysteresis < 0)
+    {
+        err = "Bad LLF config (HYSTERESIS >= 0)";
+        return false;
+    }
+    if (!cfg.speeds.empty())
+    {
+        if ((int)cfg.speeds.size() != total)
+        {
+            err = "SPEED needs one value per processor";
+            return false;
+        }
+        for (int v : cfg.speeds)
+            if (v < 1 || v > SPEED_MAX)
+            {
+                err = "Bad SPEED value " + std::to_string(v);
+                return false;
+            }
+    }
+    if (cfg.powerEnabled)
+    {
+        bool ok = cfg.idleThreshold >= 0 && cfg.wakeLatency >= 0 &&
+                  (int)cfg.powerBusy.size() == TYPE_COUNT &&
+                  (int)cfg.powerIdle.size() == TYPE_COUNT &&
+                  (int)cfg.powerSleep.size() == TYPE_COUNT;
+        for (int i = 0; ok && i < TYPE_COUNT; ++i)
+            ok = cfg.powerBusy[i] >= 0 && cfg.powerIdle[i] >= 0 && cfg.powerSleep[i] >= 0;
+        if (!ok)
         {
-            err = "IOcount mismatch in line: " + line;
+            err = "Bad POWER config (all values >= 0, one busy/idle/sleep triple per type)";
+            return false;
+        }
+    }
+    if (n < 0 || nk < 0)
+    {
+        err = "Bad workload size (negative)";
+        return false;
+    }
+    for (int i = 0; i < n; ++i)
+        if (procs[i].weight <= 0)
+        {
+            err = "Bad process weight (must be > 0): PID " + std::to_string(procs[i].PID);
+            return false;
+        }
+    for (const TaskSpec &t : cfg.tasks)
+        if (!checkTask(t, err))
+        {
+            err = "Bad task (PID " + std::to_string(t.pid) + "): " + err;
             return false;
         }
 
-        // ---- Build IO array (adjust struct name/fields if needed) ----
+    static_cast<SimConfig &>(out) = cfg;
+    out.M = n;
+
+    std::vector<Process *> procVec;
+    procVec.reserve((size_t)n);
+    for (int i = 0; i < n; ++i)
+    {
+        const ProcessSpec &ps = procs[i];
+        int ioCount = (int)ps.io.size();
         IORequest *ioArr = nullptr;
         if (ioCount > 0)
         {
             ioArr = new IORequest[ioCount];
             for (int k = 0; k < ioCount; ++k)
-            {
-                ioArr[k].io_r = pairs[k].first;
-                ioArr[k].io_d = pairs[k].second;
-            }
+                ioArr[k] = ps.io[k];
         }
 
-        Process *p = new Process(PID, AT, CT, ioCount, ioArr);
-
-        // ✅ EDF: store absolute deadline if present
-        if (DL >= 0)
-            p->setDeadline(DL);
+        Process *p = new Process(ps.PID, ps.AT, ps.CT, ioCount, ioArr);
+        if (ps.DL >= 0)
+            p->setDeadline(ps.DL);
+        p->setWeight(ps.weight);
 
         out.allProcesses.pushBack(p);
         procVec.push_back(p);
-
-        ++readCount;
     }
 
-    // Ensure NEW list is sorted by AT (and PID tie-break)
     std::sort(procVec.begin(), procVec.end(),
               [](Process *a, Process *b)
               {
@@ -362,34 +1087,44 @@ bool InputParser::parseFile(const std::string &path, ParsedInput &out, std::stri
                       return a->getAT() < b->getAT();
                   return a->getPID() < b->getPID();
               });
-
     for (Process *p : procVec)
         out.newList.pushBack(p);
 
-    // ---- Kill events until EOF ----
-    std::vector<KillEvent> kills;
-    while (readNextDataLine(line))
-    {
-        std::stringstream ss(line);
-        KillEvent k;
-        if (!(ss >> k.time >> k.pid))
-        {
-            err = "Bad kill event line: " + line;
-            return false;
-        }
-        kills.push_back(k);
-    }
+    if (!checkTaskPids(out.tasks, out.allProcesses, err))
+        return false;
 
-    std::sort(kills.begin(), kills.end(),
+    std::vector<KillEvent> killVec(kills, kills + nk);
+    std::sort(killVec.begin(), killVec.end(),
               [](const KillEvent &a, const KillEvent &b)
               {
                   if (a.time != b.time)
                       return a.time < b.time;
                   return a.pid < b.pid;
               });
-
-    for (auto &k : kills)
+    for (auto &k : killVec)
         out.killEvents.pushBack(k);
 
     return true;
 }
+
+void InputParser::toSpecs(const ParsedInput &in,
+                          std::vector<ProcessSpec> &procs,
+                          std::vector<KillEvent> &kills)
+{
+    procs.clear();
+    kills.clear();
+    for (Node<Process *> *n = in.allProcesses.getHead(); n; n = n->next)
+    {
+        const Process *p = n->data;
+        ProcessSpec ps;
+        ps.AT = p->getAT();
+        ps.PID = p->getPID();
+        ps.CT = p->getCT();
+        ps.DL = p->hasDeadline() ? p->getDeadline() : -1;
+        ps.weight = p->getWeight();
+        ps.io.assign(p->getIOArr(), p->getIOArr() + p->getIOCount());
+        procs.push_back(ps);
+    }
+    for (Node<KillEvent> *k = in.killEvents.getHead(); k; k = k->next)
+        kills.push_back(k->data);
+}
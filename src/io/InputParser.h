@@ -1,14 +1,49 @@
 #pragma once
 #include <string>
+#include <vector>
 #include "ds/LinkedList.h"
 #include "model/Process.h"
 #include "model/KillEvent.h"
+#include "model/TaskSpec.h"
 
-struct ParsedInput
+// everything in an input file except the processes and kill events
+struct SimConfig
 {
     int NF{}, NS{}, NR{}, NE{};
+    int NM{}; // MLFQ processors (optional 5th count)
+    int NC{}; // CFS processors (optional 6th count)
+    int NL{}; // LLF processors (optional 7th count)
     int timeSlice{};
+
+    // MLFQ config (only read when NM > 0)
+    int mlfqLevels{};
+    int mlfqBoost{};             // boost period in ticks, 0 = never
+    std::vector<int> mlfqQuanta; // one quantum per level
+
+    // CFS config (only read when NC > 0)
+    int cfsLatency{};  // target latency: period shared by all runnable processes
+    int cfsMinGran{};  // minimum slice
+
+    // LLF config (only read when NL > 0)
+    int llfHysteresis{}; // preempt only when RDY top is this much less lax than RUN
+    // optional SPEED line: one speed per processor in SPEED_ONE units
+    // (TickKernel.h), in global processor order; empty = all 1.0
+    std::vector<int> speeds;
+
+    // optional POWER line; power model is off when absent
+    bool powerEnabled{};
+    int idleThreshold{}; // idle ticks before a CPU goes to sleep
+    int wakeLatency{};   // ticks to wake a sleeping CPU
+    std::vector<double> powerBusy, powerIdle, powerSleep; // per processor type, ProcType order
+
     int RTF{}, MaxW{}, STL{}, forkProb{};
+
+    // PERIODIC / SPORADIC lines; their jobs are generated during the run
+    std::vector<TaskSpec> tasks;
+};
+
+struct ParsedInput : SimConfig
+{
     int M{};
 
     LinkedList<Process *> newList;      // NEW processes (sorted by AT in input)
@@ -16,8 +51,54 @@ struct ParsedInput
     LinkedList<Process *> allProcesses; // for memory ownership cleanup
 };
 
+// one process of an in-memory workload (the fields of a process line)
+struct ProcessSpec
+{
+    long long AT{};
+    int PID{}, CT{};
+    long long DL = -1; // -1: no deadline
+    int weight = 1;
+    std::vector<IORequest> io;
+};
+
+// how the cluster dispatcher picks a node for each arrival
+enum class RoutePolicy
+{
+    RoundRobin,
+    LeastEFT,  // node whose best processor would finish the job first
+    PowerOfTwo // better of two randomly sampled nodes
+};
+
+struct ClusterInput
+{
+    RoutePolicy policy{};
+    int netDelay{};                     // ticks between routing a job and its arrival at the node
+    std::vector<std::string> nodeFiles; // one regular input file per node (processor mix + config)
+    int M{};
+    LinkedList<Process *> workload; // shared arrivals, sorted by AT; owned until routed
+};
+
 class InputParser
 {
 public:
     static bool parseFile(const std::string &path, ParsedInput &out, std::string &err);
+    static bool parseCluster(const std::string &path, ClusterInput &out, std::string &err);
+
+    // in-memory equivalent of parseFile: same checks, same NEW / kill ordering
+    static bool build(const SimConfig &cfg,
+                      const ProcessSpec *procs, int n,
+                      const KillEvent *kills, int nk,
+                      ParsedInput &out, std::string &err);
+
+    // the workload of a parsed input as specs for build() (e.g. to load it
+    // again under a changed SimConfig); processes in input order
+    static void toSpecs(const ParsedInput &in,
+                        std::vector<ProcessSpec> &procs,
+                        std::vector<KillEvent> &kills);
+
+    // AT PID CT [DL] IOcount (IO_R,IO_D)... [WEIGHT]; nullptr + err on failure
+    static Process *parseProcessLine(const std::string &line, std::string &err);
+    // PERIODIC|SPORADIC key=value... (IO_R,IO_D)...
+    static bool isTaskLine(const std::string &line);
+    static bool parseTaskLine(const std::string &line, TaskSpec &out, std::string &err);
 };
@@ -0,0 +1,217 @@
+#include "io/OnlineFeed.h"
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include "io/InputParser.h"
+#include "model/Process.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+OnlineFeed::OnlineFeed()
+    : ring(nullptr), fd(-1), ownFd(false),
+      closing(false), eof(false), watermark(0), rejected(0),
+      pacing(Pacing::Arrivals), msPerTick(0), started(false) {}
+
+OnlineFeed::~OnlineFeed()
+{
+    close();
+}
+
+bool OnlineFeed::parsePacing(const std::string &s, Pacing &p, double &ms)
+{
+    if (s == "arrivals")
+    {
+        p = Pacing::Arrivals;
+        return true;
+    }
+    if (s.rfind("wall:", 0) != 0)
+        return false;
+    char *end = nullptr;
+    double v = std::strtod(s.c_str() + 5, &end);
+    if (*end != '\0' || !(v > 0))
+        return false;
+    p = Pacing::WallClock;
+    ms = v;
+    return true;
+}
+
+#ifdef _WIN32
+
+bool OnlineFeed::open(const std::string &, Pacing, double, std::string &err)
+{
+    err = "online mode needs POSIX poll()";
+    return false;
+}
+
+void OnlineFeed::close() {}
+
+void OnlineFeed::readLoop() {}
+
+#else
+
+bool OnlineFeed::open(const std::string &path, Pacing p, double ms, std::string &err)
+{
+    close();
+    if (path.empty() || path == "-")
+    {
+        fd = STDIN_FILENO;
+        ownFd = false;
+    }
+    else
+    {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            err = "Cannot open online input: " + path;
+            return false;
+        }
+        ownFd = true;
+    }
+
+    pacing = p;
+    msPerTick = ms;
+    started = false;
+    closing.store(false);
+    eof.store(false);
+    watermark.store(0);
+    rejected.store(0);
+    ring = new SpscRing<Item>(4096);
+    reader = std::thread(&OnlineFeed::readLoop, this);
+    return true;
+}
+
+void OnlineFeed::close()
+{
+    if (!ring)
+        return;
+    closing.store(true, std::memory_order_release);
+    reader.join();
+    Item it;
+    while (ring->read(&it, 1))
+        delete it.proc;
+    delete ring;
+    ring = nullptr;
+    if (ownFd)
+        ::close(fd);
+    fd = -1;
+}
+
+// polls with a timeout so close() can stop a reader waiting on a quiet pipe
+void OnlineFeed::readLoop()
+{
+    std::string pending;
+    char buf[4096];
+    bool more = true;
+    while (more && !closing.load(std::memory_order_acquire))
+    {
+        pollfd pfd{fd, POLLIN, 0};
+        int r = ::poll(&pfd, 1, 100);
+        if (r == 0 || (r < 0 && errno == EINTR))
+            continue;
+        if (r < 0)
+            break;
+        ssize_t k = ::read(fd, buf, sizeof buf);
+        if (k < 0 && errno == EINTR)
+            continue;
+        if (k <= 0)
+            break;
+        pending.append(buf, (std::size_t)k);
+
+        std::size_t from = 0, nl;
+        while (more && (nl = pending.find('\n', from)) != std::string::npos)
+        {
+            more = handleLine(pending.substr(from, nl - from));
+            from = nl + 1;
+        }
+        pending.erase(0, from);
+    }
+    if (more && !pending.empty())
+        handleLine(pending);
+    eof.store(true, std::memory_order_release);
+}
+
+#endif
+
+bool OnlineFeed::handleLine(const std::string &raw)
+{
+    std::string line = raw.substr(0, raw.find("//"));
+    std::stringstream ss(line);
+    std::string word;
+    if (!(ss >> word))
+        return true;
+
+    std::string err;
+    if (word == "end")
+        return false;
+    if (word == "kill" || word == "clock")
+    {
+        long long t = 0;
+        int pid = 0;
+        bool ok = (ss >> t) && t >= 0 && (word == "clock" || (ss >> pid));
+        std::string extra;
+        if (ok && !(ss >> extra))
+        {
+            if (word == "kill")
+                push(Item{nullptr, KillEvent{t, pid}});
+            advance(t);
+            return true;
+        }
+        err = "Bad " + word + " line: " + line;
+    }
+    else if (Process *p = InputParser::parseProcessLine(line, err))
+    {
+        push(Item{p, KillEvent{}});
+        advance(p->getAT());
+        return true;
+    }
+
+    rejected.fetch_add(1, std::memory_order_relaxed);
+    std::cerr << "online: " << err << "\n";
+    return true;
+}
+
+void OnlineFeed::push(const Item &it)
+{
+    while (ring->write(&it, 1) == 0)
+    {
+        if (closing.load(std::memory_order_acquire))
+        {
+            delete it.proc;
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100)); // ring full
+    }
+}
+
+// after the item it belongs to is in the ring, so a consumer that sees the
+// new watermark also sees the item
+void OnlineFeed::advance(long long t)
+{
+    if (t > watermark.load(std::memory_order_relaxed))
+        watermark.store(t, std::memory_order_release);
+}
+
+void OnlineFeed::waitForTick(long long t)
+{
+    if (pacing == Pacing::WallClock)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (!started)
+        {
+            start = now;
+            started = true;
+        }
+        auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                               std::chrono::duration<double, std::milli>(msPerTick * (double)t));
+        if (due > now)
+            std::this_thread::sleep_until(due);
+        return;
+    }
+    while (!inputClosed() && watermark.load(std::memory_order_acquire) <= t)
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
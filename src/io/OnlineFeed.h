@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "ds/SpscRing.h"
+#include "model/KillEvent.h"
+
+class Process;
+
+// Online mode input: lines read from stdin or a named pipe while the
+// simulation runs. A reader thread parses them and hands them to the
+// simulation through an SPSC ring, which the Scheduler drains at the start
+// of every tick (see Scheduler::runOnline).
+//
+//   AT PID CT [DL] IOcount (IO_R,IO_D)... [WEIGHT]   process, as in an input file
+//   kill T PID                                       SIGKILL at tick T
+//   clock T                                          nothing more arrives before T
+//   end                                              end of input (as EOF)
+//
+// Bad lines are reported on stderr and skipped.
+class OnlineFeed
+{
+public:
+    enum class Pacing
+    {
+        Arrivals, // tick t runs once the input has gone past t (or ended)
+        WallClock // tick t runs msPerTick * t milliseconds after the first one
+    };
+
+    struct Item
+    {
+        Process *proc; // nullptr: kill
+        KillEvent kill;
+    };
+
+private:
+    SpscRing<Item> *ring;
+    std::thread reader;
+    int fd;
+    bool ownFd;
+    std::atomic<bool> closing;
+    std::atomic<bool> eof;            // set after the reader's last item
+    std::atomic<long long> watermark; // latest time any line carried
+    std::atomic<long long> rejected;
+
+    Pacing pacing;
+    double msPerTick;
+    bool started;
+    std::chrono::steady_clock::time_point start;
+
+    void readLoop();
+    bool handleLine(const std::string &line); // false: `end`
+    void push(const Item &it);
+    void advance(long long t);
+
+public:
+    OnlineFeed();
+    ~OnlineFeed();
+
+    OnlineFeed(const OnlineFeed &) = delete;
+    OnlineFeed &operator=(const OnlineFeed &) = delete;
+
+    // path "" or "-": stdin. Opening a named pipe waits for a writer.
+    bool open(const std::string &path, Pacing p, double msPerTick, std::string &err);
+    // stops the reader; processes not drained yet are deleted
+    void close();
+
+    // consumer side
+    void waitForTick(long long t);
+    // true once everything the input will ever send is in the ring
+    bool inputClosed() const { return eof.load(std::memory_order_acquire); }
+    std::size_t read(Item *dst, std::size_t n) { return ring->read(dst, n); }
+    long long getRejected() const { return rejected.load(std::memory_order_relaxed); }
+
+    // "arrivals" or "wall:MS"
+    static bool parsePacing(const std::string &s, Pacing &p, double &msPerTick);
+};
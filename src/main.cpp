@@ -1,6 +1,10 @@
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include "core/Scheduler.h"
+#include "core/Cluster.h"
+#include "core/Tuner.h"
+#include "core/WhatIf.h"
 
 static UIMode parseMode(int argc, char **argv)
 {
@@ -27,14 +31,176 @@ static bool hasFlag(int argc, char **argv, const char *flag)
 
 int main(int argc, char **argv)
 {
-    if (argc < 2)
+    const bool tune = argc > 1 && std::string(argv[1]) == "tune";
+    const bool branch = argc > 1 && std::string(argv[1]) == "branch";
+    if (argc < 2 || ((tune || branch) && argc < 3))
     {
-        std::cout << "Usage: ProcessScheduler <input_file> --mode=interactive|step|silent\n";
+        std::cout << "Usage: ProcessScheduler <input_file> --mode=interactive|step|silent"
+                     " [--deadline-policy=soft|firm] [--ready-queue=radix|heap] [--wait-report]\n"
+                     "       [--sample=N [--sample-out=file.csv|file.bin] [--sample-budget=K]]\n"
+                     "       [--break-at=T] [--break-state=PID:STATE] [--break-rdy=N]"
+                     " [--break-on=kill,migrate,steal,fork]\n"
+                     "       [--live=N [--live-out=file]] [--horizon=T]\n"
+                     "       [--online[=pipe] [--pace=arrivals|wall:MS]]\n"
+                     "       ProcessScheduler --cluster=<cluster_file> [same options]\n"
+                     "       ProcessScheduler tune <input_file> [--objective=avg-trt|p99-trt|dl-met|util]"
+                     " [--candidates=N] [--eta=N] [--threads=N] [--mix] [--seed=N]\n"
+                     "       ProcessScheduler branch <input_file> --at=T --branch=KEY=V,KEY+N,... [--branch=...]"
+                     " [--threads=N] [--seed=N]\n";
         return 1;
     }
 
-    Scheduler s;
+    UIMode mode = UIMode::Interactive;
+    DeadlinePolicy dlPolicy = DeadlinePolicy::Soft;
+    ReadyQueueKind rdyKind = ReadyQueueKind::Radix;
+    bool waitReport = false;
+    Breakpoints brk;
+    int liveEvery = 0;
+    std::string livePath = "data/live.stats";
     std::string err;
+    std::string clusterPath;
+    int sampleEvery = 0;
+    int sampleBudget = 4096;
+    std::string samplePath = "data/samples.csv";
+    Tuner::Options tuneOpt;
+    WhatIf::Options branchOpt;
+    int threads = 0;
+    std::uint32_t seed = 1;
+    long long horizon = 0;
+    bool online = false;
+    std::string onlinePath; // empty: stdin
+    OnlineFeed::Pacing pacing = OnlineFeed::Pacing::Arrivals;
+    double msPerTick = 0;
+    for (int i = (tune || branch) ? 3 : 1; i < argc; ++i)
+    {
+        std::string a = argv[i];
+        if (a == "--mode=step")
+            mode = UIMode::Step;
+        else if (a == "--mode=silent")
+            mode = UIMode::Silent;
+        else if (a == "--mode=interactive")
+            mode = UIMode::Interactive;
+        else if (a == "--deadline-policy=firm")
+            dlPolicy = DeadlinePolicy::Firm;
+        else if (a == "--deadline-policy=soft")
+            dlPolicy = DeadlinePolicy::Soft;
+        else if (a == "--ready-queue=heap")
+            rdyKind = ReadyQueueKind::BinaryHeap;
+        else if (a == "--ready-queue=radix")
+            rdyKind = ReadyQueueKind::Radix;
+        else if (a == "--wait-report")
+            waitReport = true;
+        else if (a.rfind("--cluster=", 0) == 0)
+            clusterPath = a.substr(10);
+        else if (a.rfind("--sample=", 0) == 0)
+            sampleEvery = std::atoi(a.c_str() + 9);
+        else if (a.rfind("--sample-budget=", 0) == 0)
+            sampleBudget = std::atoi(a.c_str() + 16);
+        else if (a.rfind("--sample-out=", 0) == 0)
+            samplePath = a.substr(13);
+        else if (a.rfind("--live=", 0) == 0)
+            liveEvery = std::atoi(a.c_str() + 7);
+        else if (a.rfind("--live-out=", 0) == 0)
+            livePath = a.substr(11);
+        else if (a.rfind("--objective=", 0) == 0 && !Tuner::parseObjective(a.substr(12), tuneOpt.objective))
+        {
+            std::cout << "Unknown objective: " << a.substr(12) << "\n";
+            return 1;
+        }
+        else if (a.rfind("--candidates=", 0) == 0)
+            tuneOpt.candidates = std::atoi(a.c_str() + 13);
+        else if (a.rfind("--eta=", 0) == 0)
+            tuneOpt.eta = std::atoi(a.c_str() + 6);
+        else if (a.rfind("--threads=", 0) == 0)
+            threads = std::atoi(a.c_str() + 10);
+        else if (a == "--mix")
+            tuneOpt.tuneMix = true;
+        else if (a.rfind("--seed=", 0) == 0)
+            seed = (std::uint32_t)std::strtoul(a.c_str() + 7, nullptr, 10);
+        else if (a.rfind("--at=", 0) == 0)
+            branchOpt.at = std::strtoll(a.c_str() + 5, nullptr, 10);
+        else if (a.rfind("--horizon=", 0) == 0)
+            horizon = std::strtoll(a.c_str() + 10, nullptr, 10);
+        else if (a == "--online")
+            online = true;
+        else if (a.rfind("--online=", 0) == 0)
+        {
+            online = true;
+            onlinePath = a.substr(9);
+        }
+        else if (a.rfind("--pace=", 0) == 0 && !OnlineFeed::parsePacing(a.substr(7), pacing, msPerTick))
+        {
+            std::cout << "Bad pacing: " << a.substr(7) << "\n";
+            return 1;
+        }
+        else if (a.rfind("--branch=", 0) == 0)
+            branchOpt.branches.push_back(a.substr(9));
+        else if (a.rfind("--break-", 0) == 0 && !brk.parseArg(a, err))
+        {
+            std::cout << err << "\n";
+            return 1;
+        }
+    }
+
+    if (tune)
+    {
+        Tuner t;
+        tuneOpt.threads = threads;
+        tuneOpt.seed = seed;
+        tuneOpt.dlPolicy = dlPolicy;
+        tuneOpt.rdyKind = rdyKind;
+        tuneOpt.horizon = horizon;
+        if (!t.load(argv[2], err))
+        {
+            std::cout << "Load failed: " << err << "\n";
+            return 1;
+        }
+        if (!t.run(tuneOpt, std::cout, err))
+        {
+            std::cout << "Tune failed: " << err << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (branch)
+    {
+        branchOpt.threads = threads;
+        branchOpt.seed = seed;
+        branchOpt.dlPolicy = dlPolicy;
+        branchOpt.rdyKind = rdyKind;
+        branchOpt.horizon = horizon;
+        if (!WhatIf().run(argv[2], branchOpt, std::cout, err))
+        {
+            std::cout << "Branch failed: " << err << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (!clusterPath.empty())
+    {
+        Cluster c;
+        c.setDeadlinePolicy(dlPolicy);
+        c.setReadyQueueKind(rdyKind);
+        c.setWaitReport(waitReport);
+        c.setHorizon(horizon);
+        if (!c.load(clusterPath, err))
+        {
+            std::cout << "Load failed: " << err << "\n";
+            return 1;
+        }
+        c.printLoadedSummary();
+        c.simulate(mode);
+        return 0;
+    }
+
+    Scheduler s;
+    s.setDeadlinePolicy(dlPolicy);
+    s.setReadyQueueKind(rdyKind);
+    s.setWaitReport(waitReport);
+    s.setBreakpoints(brk);
+    s.setHorizon(horizon);
     if (!s.load(argv[1], err))
     {
         std::cout << "Load failed: " << err << "\n";
@@ -43,18 +209,44 @@ int main(int argc, char **argv)
 
     s.printLoadedSummary();
 
-    UIMode mode = UIMode::Interactive;
-    for (int i = 1; i < argc; ++i)
+    Sampler sampler;
+    if (sampleEvery > 0)
     {
-        std::string a = argv[i];
-        if (a == "--mode=step")
-            mode = UIMode::Step;
-        else if (a == "--mode=silent")
-            mode = UIMode::Silent;
-        else if (a == "--mode=interactive")
-            mode = UIMode::Interactive;
+        if (!sampler.open(samplePath, s.processorCount(), sampleEvery, sampleBudget, err))
+        {
+            std::cout << "Sampler: " << err << "\n";
+            return 1;
+        }
+        s.attachSampler(&sampler);
     }
 
-    s.simulate(mode);
+    LiveStats live;
+    if (liveEvery > 0)
+    {
+        if (!live.open(livePath, s.processorCount(), liveEvery, err))
+        {
+            std::cout << "Live stats: " << err << "\n";
+            return 1;
+        }
+        LiveStats::installSnapshotSignal();
+        s.attachLiveStats(&live);
+    }
+
+    if (online)
+    {
+        OnlineFeed feed;
+        if (!feed.open(onlinePath, pacing, msPerTick, err))
+        {
+            std::cout << "Online: " << err << "\n";
+            return 1;
+        }
+        s.simulateOnline(feed, std::cout);
+        feed.close();
+        if (feed.getRejected() > 0)
+            std::cerr << feed.getRejected() << " online input lines rejected\n";
+    }
+    else
+        s.simulate(mode);
+    sampler.close();
     return 0;
 }
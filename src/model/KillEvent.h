@@ -2,6 +2,6 @@
 
 struct KillEvent
 {
-    int time;
+    long long time;
     int pid;
 };
@@ -1,13 +1,13 @@
 #include "model/Process.h"
 
-Process::Process(int PID, int AT, int CT, int ioCnt, IORequest *ioArr)
+Process::Process(int PID, long long AT, int CT, int ioCnt, IORequest *ioArr)
     : pid(PID), at(AT), ct(CT),
       remaining(CT), executed(0),
       ioCount(ioCnt), io(ioArr),
       nextIOIdx(0), pendingIODur(0), totalIODur(0),
       state(ProcState::NEW),
-      firstRunSet(false), firstRunTime(-1),
-      tt(-1)
+      firstRunSet(false), firstRunTime(-1), firstRunCPU(-1),
+      tt(-1), stateSince(AT)
 {
     for (int i = 0; i < ioCount; ++i)
         totalIODur += io[i].io_d;
@@ -18,22 +18,93 @@ Process::~Process()
     delete[] io;
 }
 
-void Process::markFirstRunIfNeeded(int t)
+Process *Process::copyOf(const Process &o, const int *cpuID)
+{
+    IORequest *ioArr = o.ioCount > 0 ? new IORequest[o.ioCount] : nullptr;
+    for (int i = 0; i < o.ioCount; ++i)
+        ioArr[i] = o.io[i];
+    Process *p = new Process(o.pid, o.at, o.ct, o.ioCount, ioArr);
+
+    p->remaining = o.remaining;
+    p->executed = o.executed;
+    p->nextIOIdx = o.nextIOIdx;
+    p->pendingIODur = o.pendingIODur;
+    p->state = o.state;
+    p->firstRunSet = o.firstRunSet;
+    p->firstRunTime = o.firstRunTime;
+    p->firstRunCPU = o.firstRunCPU >= 0 ? cpuID[o.firstRunCPU] : -1;
+    p->cpu = o.cpu >= 0 ? cpuID[o.cpu] : -1;
+    p->tt = o.tt;
+    p->forkedChild = o.forkedChild;
+    p->forkedOnce = o.forkedOnce;
+    p->deadline = o.deadline;
+    p->mlfqLevel = o.mlfqLevel;
+    p->weight = o.weight;
+    p->vruntime = o.vruntime;
+    p->cfsEnqueuedAt = o.cfsEnqueuedAt;
+    p->llfKey = o.llfKey;
+    p->wakeDelay = o.wakeDelay;
+    p->wakeDelayRT = o.wakeDelayRT;
+    p->stateSince = o.stateSince;
+    p->onIODevice = o.onIODevice;
+    p->rdyTime = o.rdyTime;
+    p->runTime = o.runTime;
+    p->blkWaitTime = o.blkWaitTime;
+    p->ioTime = o.ioTime;
+    p->waitCause = o.waitCause;
+    for (int i = 0; i < WAIT_CAUSE_COUNT; ++i)
+        p->waitBy[i] = o.waitBy[i];
+    return p;
+}
+
+void Process::markFirstRunIfNeeded(long long t, int cpuID)
 {
     if (!firstRunSet)
     {
         firstRunSet = true;
         firstRunTime = t;
+        firstRunCPU = cpuID;
     }
 }
 
-void Process::cpuTick()
+void Process::closeStateInterval(long long now)
 {
-    if (remaining > 0)
+    long long d = now - stateSince;
+    switch (state)
     {
-        --remaining;
-        ++executed;
+    case ProcState::RDY:
+        rdyTime += d;
+        waitBy[(int)waitCause] += d;
+        break;
+    case ProcState::RUN:
+        runTime += d;
+        break;
+    case ProcState::BLK:
+        if (onIODevice)
+            ioTime += d;
+        else
+        {
+            blkWaitTime += d;
+            waitBy[(int)WaitCause::IO_DEVICE] += d;
+        }
+        break;
+    default:
+        break; // NEW (routed network delay) and TRM are not accounted
     }
+    stateSince = now;
+}
+
+void Process::setState(ProcState s, long long now)
+{
+    closeStateInterval(now);
+    onIODevice = false;
+    state = s;
+}
+
+void Process::startIO(long long now)
+{
+    closeStateInterval(now);
+    onIODevice = true;
 }
 
 bool Process::ioDueNow() const
@@ -11,11 +11,34 @@ enum class ProcState
     TRM
 };
 
+// What a waiting interval (RDY, or BLK before the IO device) is charged to.
+// The QUEUED_* entries follow ProcType order: waiting in that type's RDY.
+enum class WaitCause : unsigned char
+{
+    QUEUED_FCFS,
+    QUEUED_SJF,
+    QUEUED_RR,
+    QUEUED_EDF,
+    QUEUED_MLFQ,
+    QUEUED_CFS,
+    QUEUED_LLF,
+    MIGRATION_RTF,  // RDY on the SJF processor an RTF migration moved it to
+    MIGRATION_MAXW, // RDY on the RR processor a MaxW migration moved it to
+    STOLEN_LATE,    // RDY on the donor before a work steal moved it
+    EDF_PREEMPT,    // RDY after an EDF arrival / IO return preempted it
+    LLF_PREEMPT,    // RDY after a smaller-laxity job preempted it
+    IO_DEVICE       // BLK while another process holds the IO device
+};
+constexpr int WAIT_CAUSE_COUNT = (int)WaitCause::IO_DEVICE + 1;
+
+// Absolute times (AT, TT, deadline, state timestamps) and accumulated
+// times are 64-bit. Per-job durations (CT, IO_R, IO_D) stay int: they are
+// carried in the tick kernel's 32-bit lanes, and the parser rejects larger ones.
 class Process
 {
 private:
     int pid;
-    int at;
+    long long at;
     int ct;
 
     int remaining;
@@ -26,13 +49,15 @@ private:
 
     int nextIOIdx;    // next IO request index
     int pendingIODur; // IO duration waiting to be served by I/O device
-    int totalIODur;   // sum of all IO durations (for later output)
+    long long totalIODur; // sum of all IO durations (for later output)
 
     ProcState state;
 
     bool firstRunSet;
-    int firstRunTime;
-    int tt; // termination time
+    long long firstRunTime;
+    int firstRunCPU; // processor ID of the first dispatch, -1 if never ran
+    int cpu = -1;    // processor whose RDY/RUN last held this process
+    long long tt; // termination time
 
     Process *parent = nullptr;
     LinkedList<Process *> children; // store pointers only (do NOT delete children here)
@@ -40,50 +65,138 @@ private:
     bool forkedChild = false; // true if created by fork
     bool forkedOnce = false;  // each process can fork at most once
 
-    int deadline = -1; // absolute deadline time, -1 means "no deadline"
+    long long deadline = -1; // absolute deadline time, -1 means "no deadline"
+
+    int mlfqLevel = 0; // MLFQ priority level (0 = highest), kept across processors
+
+    int weight = 1;                // CFS share weight (optional input column)
+    long long vruntime = 0;        // CFS virtual runtime, CFSProcessor::VRT_SCALE units per tick at weight 1
+    long long cfsEnqueuedAt = 0;   // time of the last CFS RDY insert (scheduling latency stats)
+
+    long long llfKey = 0; // LLF time-offset laxity, fixed while in an LLF RDY
+
+    long long wakeDelay = 0;   // ticks spent waiting for a sleeping CPU to wake up
+    long long wakeDelayRT = 0; // the part of wakeDelay before the first run
+
+    // time per state, accounted when the state changes (not per tick).
+    // BLK is split into waiting for the IO device and being served by it.
+    long long stateSince; // time of the last transition (AT until admitted)
+    bool onIODevice = false;
+    long long rdyTime = 0;
+    long long runTime = 0;
+    long long blkWaitTime = 0;
+    long long ioTime = 0;
+
+    WaitCause waitCause = WaitCause::QUEUED_FCFS; // charged when the RDY interval closes
+    long long waitBy[WAIT_CAUSE_COUNT] = {};
+
+    void closeStateInterval(long long now);
 
 public:
-    Process(int PID, int AT, int CT, int ioCnt, IORequest *ioArr);
+    Process(int PID, long long AT, int CT, int ioCnt, IORequest *ioArr);
     ~Process();
 
     Process(const Process &) = delete;
     Process &operator=(const Process &) = delete;
 
+    // deep copy for a Scheduler clone, processor IDs translated through
+    // cpuID; parent / children are left for the caller to link
+    static Process *copyOf(const Process &o, const int *cpuID);
+
     // getters
     int getPID() const { return pid; }
-    int getAT() const { return at; }
+    long long getAT() const { return at; }
     int getCT() const { return ct; }
     int getRemaining() const { return remaining; }
     int getExecuted() const { return executed; }
 
     int getIOCount() const { return ioCount; }
     const IORequest *getIOArr() const { return io; }
-    int getTotalIODur() const { return totalIODur; }
+    long long getTotalIODur() const { return totalIODur; }
 
     ProcState getState() const { return state; }
-    void setState(ProcState s) { state = s; }
+    // `now` is the simulation time of the transition
+    void setState(ProcState s, long long now);
+    // BLK: leaves blkWait for the IO device (the state stays BLK)
+    void startIO(long long now);
+    long long getStateSince() const { return stateSince; }
+
+    // residency totals (exact once TRM; TT - AT = sum of the four when
+    // admitted on arrival)
+    long long getRdyTime() const { return rdyTime; }
+    long long getRunTime() const { return runTime; }
+    long long getBlkWaitTime() const { return blkWaitTime; }
+    long long getIOTime() const { return ioTime; }
+
+    // waiting split by cause: sums to RDY + BLKW
+    void setWaitCause(WaitCause c) { waitCause = c; }
+    long long getWaitTime(WaitCause c) const { return waitBy[(int)c]; }
 
     int getPendingIO() const { return pendingIODur; }
     int getNextIOIndex() const { return nextIOIdx; }
+    int getNextIORequestTime() const { return (nextIOIdx < ioCount) ? io[nextIOIdx].io_r : -1; }
 
     // timing
-    void markFirstRunIfNeeded(int t);
+    void markFirstRunIfNeeded(long long t, int cpuID = -1);
     bool hasFirstRun() const { return firstRunSet; }
-    int getFirstRunTime() const { return firstRunTime; }
+    long long getFirstRunTime() const { return firstRunTime; }
+    int getFirstRunCPU() const { return firstRunCPU; }
+
+    int getCPU() const { return cpu; }
+    void setCPU(int id) { cpu = id; }
 
-    void setTT(int t) { tt = t; }
-    int getTT() const { return tt; }
+    void setTT(long long t) { tt = t; }
+    long long getTT() const { return tt; }
 
-    // CPU execution: one tick
-    void cpuTick();
+    // CPU execution happens in tickKernel on the processor's lane;
+    // this writes back the progress made while RUN (see Processor::clearRunning)
+    void setProgress(int rem, int exec)
+    {
+        remaining = rem;
+        executed = exec;
+    }
 
-    // IO logic: after cpuTick, check if IO is due now
+    // IO logic: after a CPU tick, check if IO is due now
     bool ioDueNow() const;
     void moveDueIOToPending(); // sets pendingIODur + advances nextIOIdx
     int takePendingIO();       // returns pending dur and clears it
 
     bool isFinished() const { return remaining <= 0; }
 
+    static const char *waitCauseName(WaitCause c)
+    {
+        switch (c)
+        {
+        case WaitCause::QUEUED_FCFS:
+            return "queued on FCFS";
+        case WaitCause::QUEUED_SJF:
+            return "queued on SJF";
+        case WaitCause::QUEUED_RR:
+            return "queued on RR";
+        case WaitCause::QUEUED_EDF:
+            return "queued on EDF";
+        case WaitCause::QUEUED_MLFQ:
+            return "queued on MLFQ";
+        case WaitCause::QUEUED_CFS:
+            return "queued on CFS";
+        case WaitCause::QUEUED_LLF:
+            return "queued on LLF";
+        case WaitCause::MIGRATION_RTF:
+            return "after RTF migration";
+        case WaitCause::MIGRATION_MAXW:
+            return "after MaxW migration";
+        case WaitCause::STOLEN_LATE:
+            return "before being stolen";
+        case WaitCause::EDF_PREEMPT:
+            return "EDF preemption";
+        case WaitCause::LLF_PREEMPT:
+            return "LLF preemption";
+        case WaitCause::IO_DEVICE:
+            return "IO device busy";
+        }
+        return "?";
+    }
+
     static const char *stateName(ProcState s)
     {
         switch (s)
@@ -114,7 +227,29 @@ public:
     void addChild(Process *c) { children.pushBack(c); }
     LinkedList<Process *> &getChildren() { return children; }
 
-    void setDeadline(int d) { deadline = d; }
-    int getDeadline() const { return deadline; }
+    void setDeadline(long long d) { deadline = d; }
+    long long getDeadline() const { return deadline; }
     bool hasDeadline() const { return deadline >= 0; }
+
+    int getMLFQLevel() const { return mlfqLevel; }
+    void setMLFQLevel(int lvl) { mlfqLevel = lvl; }
+
+    int getWeight() const { return weight; }
+    void setWeight(int w) { weight = w; }
+    long long getVruntime() const { return vruntime; }
+    void setVruntime(long long v) { vruntime = v; }
+    long long getCFSEnqueuedAt() const { return cfsEnqueuedAt; }
+    void setCFSEnqueuedAt(long long t) { cfsEnqueuedAt = t; }
+
+    void addWakeDelay(long long d)
+    {
+        wakeDelay += d;
+        if (!firstRunSet)
+            wakeDelayRT += d;
+    }
+    long long getWakeDelay() const { return wakeDelay; }
+    long long getWakeDelayRT() const { return wakeDelayRT; }
+
+    long long getLLFKey() const { return llfKey; }
+    void setLLFKey(long long k) { llfKey = k; }
 };
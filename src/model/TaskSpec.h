@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "model/IORequest.h"
+
+// A PERIODIC or SPORADIC input line: a stream of identical jobs released
+// at `offset` and then every `period` ticks (sporadic: every `period` plus
+// a seeded random extra in [0, jitter]). Job k has PID pid + k. Jobs are
+// created when released (see TaskGenerator), not when the input is read.
+struct TaskSpec
+{
+    bool sporadic{};
+    int pid{};
+    long long period{}; // sporadic: minimum inter-arrival time
+    long long offset{}; // first release
+    long long jitter{}; // sporadic only
+    std::uint64_t seed = 1;
+
+    int CT{};
+    long long DL = -1; // relative to each release, -1: no deadline
+    int weight = 1;
+    std::vector<IORequest> io;
+
+    long long count = -1; // jobs, -1: until `until`
+    long long until = -1; // no release at or after this tick, -1: `count` jobs
+};
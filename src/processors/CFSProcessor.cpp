@@ -0,0 +1,96 @@
+#include "processors/CFSProcessor.h"
+#include "model/Process.h"
+
+bool CFSProcessor::lessVruntime(Process *const &a, Process *const &b)
+{
+    if (a->getVruntime() != b->getVruntime())
+        return a->getVruntime() < b->getVruntime();
+    return a->getPID() < b->getPID();
+}
+
+CFSProcessor::CFSProcessor(int id, int latency, int minGran)
+    : Processor(id, kType), tree(&CFSProcessor::lessVruntime),
+      targetLatency(latency), minGranularity(minGran),
+      minVruntime(0), readyWeight(0), runStartExec(0),
+      dispatches(0), sliceSum(0), waitSum(0), waitMax(0), maxSpread(0) {}
+
+void CFSProcessor::enqueue(Process *p)
+{
+    // Clamp into [minVruntime, minVruntime + one latency period]: newcomers
+    // cannot undercut everyone already here, and vruntime earned on another
+    // (busier) CFS processor does not starve the process on this one.
+    long long v = p->getVruntime();
+    long long hi = minVruntime + (long long)targetLatency * VRT_SCALE;
+    if (v < minVruntime)
+        v = minVruntime;
+    else if (v > hi)
+        v = hi;
+    p->setVruntime(v);
+    p->setCFSEnqueuedAt(tracker->now);
+
+    tree.insert(p);
+    readyWeight += p->getWeight();
+    onEnqueued(p);
+}
+
+Process *CFSProcessor::popReady()
+{
+    if (tree.empty())
+        return nullptr;
+    Process *p = tree.popMin();
+    readyWeight -= p->getWeight();
+    onDequeued(p);
+    return p;
+}
+
+bool CFSProcessor::removeReady(Process *p)
+{
+    auto *node = tree.find(p);
+    if (!node)
+        return false;
+    tree.erase(node);
+    readyWeight -= p->getWeight();
+    onDequeued(p);
+    return true;
+}
+
+Process *CFSProcessor::peekReady() const
+{
+    return tree.peekMin();
+}
+
+int CFSProcessor::startRun(Process *p)
+{
+    long long w = p->getWeight();
+    long long slice = (long long)targetLatency * w / (readyWeight + w);
+    if (slice < minGranularity)
+        slice = minGranularity;
+
+    long long wait = tracker->now - p->getCFSEnqueuedAt();
+    ++dispatches;
+    sliceSum += slice;
+    waitSum += wait;
+    if (wait > waitMax)
+        waitMax = wait;
+    if (!tree.empty())
+    {
+        long long spread = (tree.peekMax()->getVruntime() - p->getVruntime()) / VRT_SCALE;
+        if (spread > maxSpread)
+            maxSpread = spread;
+    }
+
+    runStartExec = p->getExecuted();
+    return (int)slice;
+}
+
+void CFSProcessor::stopRun(Process *p)
+{
+    long long ran = p->getExecuted() - runStartExec;
+    p->setVruntime(p->getVruntime() + ran * VRT_SCALE / p->getWeight());
+
+    long long cand = p->getVruntime();
+    if (!tree.empty() && tree.peekMin()->getVruntime() < cand)
+        cand = tree.peekMin()->getVruntime();
+    if (cand > minVruntime)
+        minVruntime = cand;
+}
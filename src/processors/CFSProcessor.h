@@ -0,0 +1,77 @@
+#pragma once
+#include "processors/Processor.h"
+#include "ds/RBTree.h"
+
+class Process;
+
+// Fair-share scheduler in the style of Linux CFS. Every process accumulates
+// virtual runtime (CPU ticks scaled by 1/weight); the RDY process with the
+// least vruntime runs next, for a slice of targetLatency shared among the
+// runnable processes in proportion to their weights (never below
+// minGranularity). RDY is a red-black tree with a cached leftmost node.
+class CFSProcessor final : public Processor
+{
+public:
+    static constexpr ProcType kType = ProcType::CFS;
+    static constexpr long long VRT_SCALE = 1024; // vruntime units per tick at weight 1
+
+private:
+    static bool lessVruntime(Process *const &a, Process *const &b);
+    RBTree<Process *> tree;
+
+    int targetLatency;
+    int minGranularity;
+
+    long long minVruntime; // monotonic floor used to place incoming processes
+    long long readyWeight; // sum of weights in RDY
+    int runStartExec;      // executed time of the RUN process at dispatch
+
+    // latency / fairness stats
+    long long dispatches;
+    long long sliceSum;
+    long long waitSum; // ticks from enqueue to dispatch
+    long long waitMax;
+    long long maxSpread; // max vruntime spread in RDY seen at dispatch (ticks at weight 1)
+
+public:
+    CFSProcessor(int id, int latency, int minGran);
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return tree.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        tree.forEachInOrder([&](Process *p)
+                            { f(p, -1); });
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const CFSProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        tree.copyFrom(o.tree, map);
+        minVruntime = o.minVruntime;
+        readyWeight = o.readyWeight;
+        runStartExec = o.runStartExec;
+        dispatches = o.dispatches;
+        sliceSum = o.sliceSum;
+        waitSum = o.waitSum;
+        waitMax = o.waitMax;
+        maxSpread = o.maxSpread;
+    }
+
+    // p was just popped for RUN: record stats and return its slice
+    int startRun(Process *p);
+
+    // p left the CPU (after clearRunning wrote its progress back): charge vruntime
+    void stopRun(Process *p);
+
+    long long getDispatches() const { return dispatches; }
+    double getAvgSlice() const { return dispatches ? (double)sliceSum / dispatches : 0.0; }
+    double getAvgWait() const { return dispatches ? (double)waitSum / dispatches : 0.0; }
+    long long getMaxWait() const { return waitMax; }
+    long long getMaxSpread() const { return maxSpread; }
+};
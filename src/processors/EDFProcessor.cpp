@@ -1,10 +1,16 @@
 #include "processors/EDFProcessor.h"
 #include "model/Process.h"
+#include <climits>
+
+long long EDFProcessor::keyDeadline(const Process *p)
+{
+    return p->hasDeadline() ? p->getDeadline() : LLONG_MAX;
+}
 
 bool EDFProcessor::lessEDF(Process *const &a, Process *const &b)
 {
-    int da = a->hasDeadline() ? a->getDeadline() : INT_MAX;
-    int db = b->hasDeadline() ? b->getDeadline() : INT_MAX;
+    long long da = keyDeadline(a);
+    long long db = keyDeadline(b);
     if (da != db)
         return da < db;
     return a->getPID() < b->getPID();
@@ -12,32 +18,27 @@ bool EDFProcessor::lessEDF(Process *const &a, Process *const &b)
 
 void EDFProcessor::enqueue(Process *p)
 {
-    heap.push(p);
-    readyWork += p->getRemaining();
+    rdy.push(p);
+    onEnqueued(p);
 }
 
 Process *EDFProcessor::popReady()
 {
-    if (heap.empty())
-        return nullptr;
-    Process *p = heap.pop();
-    readyWork -= p->getRemaining();
+    Process *p = rdy.pop();
+    if (p)
+        onDequeued(p);
     return p;
 }
 
 Process *EDFProcessor::peekReady() const
 {
-    return heap.peek();
+    return rdy.peek();
 }
 
-void EDFProcessor::printReady(std::ostream &os) const
+bool EDFProcessor::removeReady(Process *p)
 {
-    Process *const *raw = heap.raw();
-    std::size_t n = heap.rawSize();
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        os << raw[i]->getPID();
-        if (i + 1 < n)
-            os << ",";
-    }
+    if (!rdy.remove(p))
+        return false;
+    onDequeued(p);
+    return true;
 }
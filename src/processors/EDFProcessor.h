@@ -1,22 +1,38 @@
 #pragma once
 #include "processors/Processor.h"
-#include "ds/MinHeap.h"
-#include <ostream>
+#include "processors/ReadyHeap.h"
 
 class Process;
 
-class EDFProcessor : public Processor
+class EDFProcessor final : public Processor
 {
 private:
+    static long long keyDeadline(const Process *p); // deadline (LLONG_MAX when none)
     static bool lessEDF(Process *const &a, Process *const &b);
-    MinHeap<Process *> heap;
+    ReadyHeap rdy;
 
 public:
-    EDFProcessor(int id) : Processor(id, ProcType::EDF), heap(&EDFProcessor::lessEDF) {}
+    static constexpr ProcType kType = ProcType::EDF;
 
-    void enqueue(Process *p) override;
-    Process *popReady() override;
-    Process *peekReady() const override;
-    std::size_t readyCount() const override { return heap.size(); }
-    void printReady(std::ostream &os) const override;
+    EDFProcessor(int id, ReadyQueueKind kind = ReadyQueueKind::Radix)
+        : Processor(id, kType), rdy(kind, &EDFProcessor::keyDeadline, &EDFProcessor::lessEDF) {}
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return rdy.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        rdy.forEach([&](Process *p)
+                    { f(p, -1); });
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const EDFProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        rdy.copyFrom(o.rdy, map);
+    }
 };
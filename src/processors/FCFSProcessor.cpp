@@ -4,7 +4,7 @@
 void FCFSProcessor::enqueue(Process *p)
 {
     rdy.enqueue(p);
-    readyWork += p->getRemaining();
+    onEnqueued(p);
 }
 
 Process *FCFSProcessor::popReady()
@@ -12,7 +12,7 @@ Process *FCFSProcessor::popReady()
     Process *p = nullptr;
     if (!rdy.dequeue(p))
         return nullptr;
-    readyWork -= p->getRemaining();
+    onDequeued(p);
     return p;
 }
 
@@ -22,18 +22,6 @@ Process *FCFSProcessor::peekReady() const
     return node ? node->data : nullptr;
 }
 
-void FCFSProcessor::printReady(std::ostream &os) const
-{
-    Node<Process *> *cur = rdy.getHead();
-    while (cur)
-    {
-        os << cur->data->getPID();
-        if (cur->next)
-            os << ",";
-        cur = cur->next;
-    }
-}
-
 bool FCFSProcessor::removeReadyByPID(int pid, Process *&out)
 {
     Queue<Process *> temp;
@@ -48,7 +36,7 @@ bool FCFSProcessor::removeReadyByPID(int pid, Process *&out)
         {
             out = p;
             found = true;
-            readyWork -= p->getRemaining();
+            onDequeued(p);
         }
         else
         {
@@ -65,3 +53,11 @@ bool FCFSProcessor::removeReadyByPID(int pid, Process *&out)
 
     return found;
 }
+
+bool FCFSProcessor::removeReady(Process *p)
+{
+    if (!rdy.remove(p))
+        return false;
+    onDequeued(p);
+    return true;
+}
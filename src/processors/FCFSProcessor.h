@@ -1,23 +1,37 @@
 #pragma once
 #include "processors/Processor.h"
 #include "ds/Queue.h"
-#include <ostream>
 
 class Process;
 
-class FCFSProcessor : public Processor
+class FCFSProcessor final : public Processor
 {
 private:
     Queue<Process *> rdy;
 
 public:
-    FCFSProcessor(int id) : Processor(id, ProcType::FCFS) {}
+    static constexpr ProcType kType = ProcType::FCFS;
 
-    void enqueue(Process *p) override;
-    Process *popReady() override;
-    Process *peekReady() const override;
-    std::size_t readyCount() const override { return rdy.size(); }
-    void printReady(std::ostream &os) const override;
+    FCFSProcessor(int id) : Processor(id, kType) {}
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return rdy.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        for (Node<Process *> *cur = rdy.getHead(); cur; cur = cur->next)
+            f(cur->data, -1);
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const FCFSProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        rdy.copyFrom(o.rdy, map);
+    }
 
     bool removeReadyByPID(int pid, Process *&out);
 };
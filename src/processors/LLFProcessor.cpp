@@ -0,0 +1,73 @@
+#include "processors/LLFProcessor.h"
+#include "model/Process.h"
+#include <climits>
+
+long long LLFProcessor::offsetKey(const Process *p) const
+{
+    return p->hasDeadline() ? (long long)p->getDeadline() - timeFor(p->getRemaining()) : LLONG_MAX;
+}
+
+bool LLFProcessor::lessLaxity(Process *const &a, Process *const &b)
+{
+    long long ka = a->getLLFKey();
+    long long kb = b->getLLFKey();
+    if (ka != kb)
+        return ka < kb;
+    return a->getPID() < b->getPID();
+}
+
+void LLFProcessor::enqueue(Process *p)
+{
+    p->setLLFKey(offsetKey(p));
+    heap.push(p);
+    onEnqueued(p);
+}
+
+Process *LLFProcessor::popReady()
+{
+    if (heap.empty())
+        return nullptr;
+    Process *p = heap.pop();
+    onDequeued(p);
+    return p;
+}
+
+Process *LLFProcessor::peekReady() const
+{
+    return heap.peek();
+}
+
+bool LLFProcessor::removeReady(Process *p)
+{
+    if (!heap.remove(p))
+        return false;
+    onDequeued(p);
+    return true;
+}
+
+long long LLFProcessor::runningLaxity() const
+{
+    if (!running || !running->hasDeadline())
+        return LLONG_MAX;
+    return (long long)running->getDeadline() - tracker->now - timeFor(getRunningRemaining());
+}
+
+long long LLFProcessor::topLaxity() const
+{
+    Process *top = heap.peek();
+    if (!top)
+        return LLONG_MAX;
+    long long k = top->getLLFKey();
+    return (k == LLONG_MAX) ? k : k - tracker->now;
+}
+
+bool LLFProcessor::shouldPreempt() const
+{
+    if (!running || heap.empty())
+        return false;
+    long long top = topLaxity();
+    if (top == LLONG_MAX)
+        return false;
+    long long run = runningLaxity();
+    return run == LLONG_MAX || top + hysteresis < run;
+}
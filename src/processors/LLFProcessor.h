@@ -0,0 +1,62 @@
+#pragma once
+#include "processors/Processor.h"
+#include "ds/MinHeap.h"
+
+class Process;
+
+// Least laxity first: laxity = DL - t - (time to run `remaining` on this
+// CPU). While a process waits, t grows and remaining does not, so every RDY
+// laxity drops by one per tick and their order never changes. RDY is
+// therefore keyed by the time-offset laxity (= laxity + t), computed once on
+// enqueue and kept on the Process; the current laxity is key - now. The RUN
+// process keeps a constant laxity, so waiting processes catch up with it:
+// the Scheduler preempts once the RDY top is more than `hysteresis` ticks
+// less lax than the RUN process.
+class LLFProcessor final : public Processor
+{
+public:
+    static constexpr ProcType kType = ProcType::LLF;
+
+private:
+    long long offsetKey(const Process *p) const; // LLONG_MAX without a deadline
+    static bool lessLaxity(Process *const &a, Process *const &b);
+    MinHeap<Process *> heap;
+
+    int hysteresis;
+    long long preemptions;
+
+public:
+    LLFProcessor(int id, int hyst)
+        : Processor(id, kType), heap(&LLFProcessor::lessLaxity), hysteresis(hyst), preemptions(0) {}
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return heap.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        for (std::size_t i = 0; i < heap.rawSize(); ++i)
+            f(heap.raw()[i], -1);
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const LLFProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        heap.copyFrom(o.heap, map);
+        preemptions = o.preemptions;
+    }
+
+    // current laxities (LLONG_MAX without a deadline)
+    long long runningLaxity() const;
+    long long topLaxity() const;
+
+    // RDY top is more urgent than RUN by more than the hysteresis
+    bool shouldPreempt() const;
+    void notePreemption() { ++preemptions; }
+
+    int getHysteresis() const { return hysteresis; }
+    long long getPreemptions() const { return preemptions; }
+};
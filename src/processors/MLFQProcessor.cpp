@@ -0,0 +1,92 @@
+#include "processors/MLFQProcessor.h"
+#include "model/Process.h"
+
+MLFQProcessor::MLFQProcessor(int id, int lv, const int *quantaIn)
+    : Processor(id, kType),
+      levels(lv), quanta(new int[lv]), rdy(new RingQueue<Process *>[lv]),
+      nonEmpty(0), demotions(0), boosts(0)
+{
+    for (int i = 0; i < levels; ++i)
+        quanta[i] = quantaIn[i];
+}
+
+MLFQProcessor::~MLFQProcessor()
+{
+    delete[] rdy;
+    delete[] quanta;
+}
+
+int MLFQProcessor::levelOf(const Process *p) const
+{
+    int lvl = p->getMLFQLevel();
+    return (lvl < levels) ? lvl : levels - 1;
+}
+
+void MLFQProcessor::enqueue(Process *p)
+{
+    int lvl = levelOf(p);
+    rdy[lvl].push(p);
+    nonEmpty |= (std::uint64_t(1) << lvl);
+    onEnqueued(p);
+}
+
+Process *MLFQProcessor::popReady()
+{
+    if (!nonEmpty)
+        return nullptr;
+    unsigned lvl = lowestSetBit(nonEmpty);
+    Process *p = nullptr;
+    rdy[lvl].pop(p);
+    if (rdy[lvl].empty())
+        nonEmpty &= ~(std::uint64_t(1) << lvl);
+    onDequeued(p);
+    return p;
+}
+
+Process *MLFQProcessor::peekReady() const
+{
+    if (!nonEmpty)
+        return nullptr;
+    return rdy[lowestSetBit(nonEmpty)].front();
+}
+
+void MLFQProcessor::demote(Process *p)
+{
+    int lvl = levelOf(p);
+    if (lvl + 1 < levels)
+    {
+        p->setMLFQLevel(lvl + 1);
+        ++demotions;
+    }
+}
+
+void MLFQProcessor::boost()
+{
+    ++boosts;
+    if (running)
+        running->setMLFQLevel(0);
+
+    // drain lower levels into level 0, keeping priority then FIFO order
+    for (int lvl = 1; lvl < levels; ++lvl)
+    {
+        Process *p = nullptr;
+        while (rdy[lvl].pop(p))
+        {
+            p->setMLFQLevel(0);
+            rdy[0].push(p);
+        }
+    }
+    if (nonEmpty)
+        nonEmpty = 1;
+}
+
+bool MLFQProcessor::removeReady(Process *p)
+{
+    int lvl = levelOf(p);
+    if (!rdy[lvl].remove(p))
+        return false;
+    if (rdy[lvl].empty())
+        nonEmpty &= ~(std::uint64_t(1) << lvl);
+    onDequeued(p);
+    return true;
+}
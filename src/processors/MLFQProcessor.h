@@ -0,0 +1,70 @@
+#pragma once
+#include "processors/Processor.h"
+#include "ds/RingQueue.h"
+#include <cstdint>
+
+class Process;
+
+// Multi-level feedback queue: one FIFO ring per priority level (0 = highest)
+// and a bitmap of non-empty levels, so pick-next is a find-lowest-set-bit.
+// A process that uses up its level's quantum is demoted one level; boost()
+// periodically lifts everything back to level 0.
+class MLFQProcessor final : public Processor
+{
+public:
+    static constexpr ProcType kType = ProcType::MLFQ;
+    static constexpr int MAX_LEVELS = 64;
+
+private:
+    int levels;
+    int *quanta;               // quantum per level
+    RingQueue<Process *> *rdy; // one queue per level
+    std::uint64_t nonEmpty;    // bit L set <=> rdy[L] non-empty
+
+    long long demotions;
+    long long boosts;
+
+    int levelOf(const Process *p) const;
+
+public:
+    // levels in [1, MAX_LEVELS]; quantaIn holds one quantum per level
+    MLFQProcessor(int id, int levels, const int *quantaIn);
+    ~MLFQProcessor();
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return readyN; }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        for (int lvl = 0; lvl < levels; ++lvl)
+            for (std::size_t i = 0; i < rdy[lvl].size(); ++i)
+                f(rdy[lvl].at(i), lvl);
+    }
+    bool removeReady(Process *p);
+
+    // o must have the same levels
+    template <typename F>
+    void copyFrom(const MLFQProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        for (int lvl = 0; lvl < levels; ++lvl)
+            rdy[lvl].copyFrom(o.rdy[lvl], map);
+        nonEmpty = o.nonEmpty;
+        demotions = o.demotions;
+        boosts = o.boosts;
+    }
+
+    int getLevels() const { return levels; }
+    int quantumFor(const Process *p) const { return quanta[levelOf(p)]; }
+
+    // RUN process used its whole quantum: move it one level down
+    void demote(Process *p);
+
+    // move every RDY process (and the RUN one) back to level 0
+    void boost();
+
+    long long getDemotions() const { return demotions; }
+    long long getBoosts() const { return boosts; }
+};
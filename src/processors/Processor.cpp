@@ -1,10 +1,202 @@
 #include "processors/Processor.h"
 #include "model/Process.h"
 
+void CpuTracker::init(std::size_t cpus)
+{
+    now = 0;
+    running.init(cpus);
+    idleWithWork.init(cpus);
+    lanes.init(cpus);
+    finished.init(cpus);
+    ioDue.init(cpus);
+    quantumExpired.init(cpus);
+    transitions.init(cpus);
+}
+
 long long Processor::expectedFinishTime() const
 {
     long long runRem = 0;
     if (running)
-        runRem = running->getRemaining();
-    return readyWork + runRem;
+        runRem = getRunningRemaining();
+    return timeFor(readyWork + runRem) + pendingWake();
+}
+
+long long Processor::pendingWake() const
+{
+    if (isAsleep())
+        return wakeLatency;
+    if (isWaking())
+        return wakeStart + wakeLatency - tracker->now;
+    return 0;
+}
+
+void Processor::openIdleSplit(long long &sleep, long long &waking) const
+{
+    sleep = waking = 0;
+    if (running || idleThreshold < 0)
+        return;
+    long long awake = awakeSince;
+    if (wakeStart >= 0)
+    {
+        if (wakeStart > awake + idleThreshold)
+            sleep += wakeStart - (awake + idleThreshold);
+        long long done = wakeStart + wakeLatency;
+        if (tracker->now < done)
+        {
+            waking = tracker->now - wakeStart;
+            return;
+        }
+        waking = wakeLatency;
+        awake = done;
+    }
+    if (tracker->now > awake + idleThreshold)
+        sleep += tracker->now - (awake + idleThreshold);
+}
+
+void Processor::foldFinishedWake()
+{
+    if (wakeStart < 0 || tracker->now < wakeStart + wakeLatency)
+        return;
+    if (wakeStart > awakeSince + idleThreshold)
+        sleepTime += wakeStart - (awakeSince + idleThreshold);
+    wakingTime += wakeLatency;
+    awakeSince = wakeStart + wakeLatency;
+    wakeStart = -1;
+}
+
+void Processor::closeIdleInterval()
+{
+    long long sleep, waking;
+    openIdleSplit(sleep, waking);
+    sleepTime += sleep;
+    wakingTime += waking;
+    wakeStart = -1;
+}
+
+bool Processor::isAsleep() const
+{
+    if (idleThreshold < 0 || running || isWaking())
+        return false;
+    long long awake = (wakeStart >= 0) ? wakeStart + wakeLatency : awakeSince;
+    return tracker->now - awake >= idleThreshold;
+}
+
+void Processor::beginWake()
+{
+    foldFinishedWake();
+    wakeStart = tracker->now;
+    ++wakeups;
+}
+
+void Processor::setRunning(Process *p)
+{
+    if (!p)
+    {
+        clearRunning();
+        return;
+    }
+    if (running)
+        clearRunning();
+
+    closeIdleInterval();
+    idleTime += tracker->now - stateSince;
+    stateSince = tracker->now;
+
+    running = p;
+    p->setCPU(id);
+    tracker->lanes.remaining[id] = p->getRemaining();
+    tracker->lanes.executed[id] = p->getExecuted();
+    tracker->lanes.nextIO[id] = p->getNextIORequestTime();
+    tracker->running.set(id);
+    refreshIdleWithWork();
+}
+
+void Processor::clearRunning()
+{
+    if (running)
+    {
+        busyTime += tracker->now - stateSince;
+        stateSince = tracker->now;
+        awakeSince = tracker->now;
+        running->setProgress(tracker->lanes.remaining[id], tracker->lanes.executed[id]);
+    }
+    running = nullptr;
+    tracker->running.reset(id);
+    refreshIdleWithWork();
+}
+
+long long Processor::getBusy() const
+{
+    long long open = running ? tracker->now - stateSince : 0;
+    return busyTime + open;
+}
+
+long long Processor::getIdle() const
+{
+    long long open = running ? 0 : tracker->now - stateSince;
+    return idleTime + open;
+}
+
+long long Processor::getSleep() const
+{
+    long long sleep, waking;
+    openIdleSplit(sleep, waking);
+    return sleepTime + sleep;
+}
+
+long long Processor::getWaking() const
+{
+    long long sleep, waking;
+    openIdleSplit(sleep, waking);
+    return wakingTime + waking;
+}
+
+void Processor::copyStateFrom(const Processor &o, Process *run)
+{
+    readyWork = o.readyWork;
+    readyN = o.readyN;
+    busyTime = o.busyTime;
+    idleTime = o.idleTime;
+    stateSince = o.stateSince;
+    awakeSince = o.awakeSince;
+    wakeStart = o.wakeStart;
+    sleepTime = o.sleepTime;
+    wakingTime = o.wakingTime;
+    wakeups = o.wakeups;
+
+    const RunLanes &from = o.tracker->lanes;
+    RunLanes &to = tracker->lanes;
+    to.remaining[id] = from.remaining[o.id];
+    to.executed[id] = from.executed[o.id];
+    to.nextIO[id] = from.nextIO[o.id];
+    to.quantum[id] = from.quantum[o.id];
+    to.slice[id] = from.slice[o.id];
+    to.accum[id] = from.accum[o.id];
+
+    running = run;
+    tracker->running.assign(id, run != nullptr);
+    refreshIdleWithWork();
+}
+
+static_assert((int)WaitCause::QUEUED_LLF == (int)ProcType::LLF, "QUEUED_* must follow ProcType");
+
+void Processor::onEnqueued(Process *p)
+{
+    p->setCPU(id);
+    p->setWaitCause((WaitCause)type); // QUEUED_* follow ProcType order
+    readyWork += p->getRemaining();
+    ++readyN;
+    refreshIdleWithWork();
+}
+
+void Processor::onDequeued(Process *p)
+{
+    readyWork -= p->getRemaining();
+    --readyN;
+    refreshIdleWithWork();
+}
+
+void Processor::refreshIdleWithWork()
+{
+    tracker->idleWithWork.assign(id, running == nullptr && readyN > 0);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
-#include <ostream>
+#include "ds/BitSet.h"
+#include "core/TickKernel.h"
 
 class Process;
 
@@ -9,7 +10,52 @@ enum class ProcType
     FCFS,
     SJF,
     RR,
-    EDF
+    EDF,
+    MLFQ,
+    CFS,
+    LLF
+};
+constexpr int PROC_TYPE_COUNT = (int)ProcType::LLF + 1;
+
+inline const char *procTypeName(ProcType t)
+{
+    switch (t)
+    {
+    case ProcType::FCFS:
+        return "FCFS";
+    case ProcType::SJF:
+        return "SJF";
+    case ProcType::RR:
+        return "RR";
+    case ProcType::EDF:
+        return "EDF";
+    case ProcType::MLFQ:
+        return "MLFQ";
+    case ProcType::CFS:
+        return "CFS";
+    case ProcType::LLF:
+        return "LLF";
+    }
+    return "?";
+}
+
+// Shared by all processors of one Scheduler: the simulation clock (ticks
+// executed so far), bitsets indexed by processor ID that the Scheduler
+// scans instead of visiting every CPU each tick, and the running-process
+// lanes the tick kernel works on.
+struct CpuTracker
+{
+    long long now = 0;
+    BitSet running;      // CPU has a RUN process
+    BitSet idleWithWork; // CPU is idle and its RDY is non-empty
+
+    RunLanes lanes;
+    BitSet finished;       // tick kernel output: RUN process has no remaining work
+    BitSet ioDue;          // tick kernel output: RUN process reached its next IO_R
+    BitSet quantumExpired; // tick kernel output: RR quantum used up
+    BitSet transitions;    // union of the three above
+
+    void init(std::size_t cpus);
 };
 
 class Processor
@@ -19,23 +65,45 @@ protected:
     ProcType type;
 
     long long readyWork; // sum of remaining in RDY
+    std::size_t readyN;  // number of processes in RDY
     Process *running;
 
+    // busy/idle time is accounted when the CPU switches state, not per tick.
+    // Must be attached before use; it also holds this CPU's run lane.
+    CpuTracker *tracker;
     long long busyTime;
     long long idleTime;
-
-    // RR only (others keep 0)
-    int timeSlice;
-    int quantumCounter;
+    long long stateSince; // tracker->now at the last busy/idle switch
+
+    // power model: an idle CPU sleeps after idleThreshold ticks and needs
+    // wakeLatency ticks before it can run again. Like busy/idle, the sleep
+    // time is derived from the idle interval when it closes.
+    int idleThreshold; // < 0: no power model
+    int wakeLatency;
+    long long awakeSince; // start of the current idle stretch while awake
+    long long wakeStart;  // tracker->now when the last wakeup began, -1 if none pending
+    long long sleepTime;
+    long long wakingTime;
+    long long wakeups;
+
+    // sleep / waking time of the still-open idle interval (0 while running)
+    void openIdleSplit(long long &sleep, long long &waking) const;
+    // a wakeup that ended without a dispatch: the CPU is awake idle since then
+    void foldFinishedWake();
+    void closeIdleInterval();
 
 public:
     Processor(int ID, ProcType t)
         : id(ID), type(t),
-          readyWork(0), running(nullptr),
-          busyTime(0), idleTime(0),
-          timeSlice(0), quantumCounter(0) {}
+          readyWork(0), readyN(0), running(nullptr),
+          tracker(nullptr),
+          busyTime(0), idleTime(0), stateSince(0),
+          idleThreshold(-1), wakeLatency(0), awakeSince(0), wakeStart(-1),
+          sleepTime(0), wakingTime(0), wakeups(0) {}
 
-    virtual ~Processor() = default;
+    // Not polymorphic: concrete processors live in per-type arrays in the
+    // Scheduler and are dispatched statically (see Scheduler::visitCPU).
+    ~Processor() = default;
 
     Processor(const Processor &) = delete;
     Processor &operator=(const Processor &) = delete;
@@ -43,32 +111,82 @@ public:
     int getID() const { return id; }
     ProcType getType() const { return type; }
 
-    int getQuantumCounter() const { return quantumCounter; }
-
     bool isIdle() const { return running == nullptr; }
     Process *getRunning() const { return running; }
 
-    void setRunning(Process *p) { running = p; }
-    void clearRunning() { running = nullptr; }
+    void attachTracker(CpuTracker *t) { tracker = t; }
+
+    // Scheduler clones: o's counters and lane with `run` (o's RUN process
+    // in the clone) running; each concrete copyFrom adds its RDY. Speed
+    // and power model come from the clone's own config.
+    void copyStateFrom(const Processor &o, Process *run);
+    // a processor added to a clone is idle since t, not since 0
+    void startIdleAt(long long t) { stateSince = awakeSince = t; }
 
+    // load/store the running process's hot state into this CPU's lane
+    void setRunning(Process *p);
+    void clearRunning();
+
+    // progress of the RUN process (its lane is authoritative while running)
+    int getRunningRemaining() const { return tracker->lanes.remaining[id]; }
+    int getRunningExecuted() const { return tracker->lanes.executed[id]; }
+
+    // speed in SPEED_ONE units (see TickKernel.h); 1.0 unless the input says otherwise
+    void setSpeed(std::int32_t s) { tracker->lanes.speed[id] = s; }
+    std::int32_t getSpeed() const { return tracker->lanes.speed[id]; }
+
+    // ticks this CPU needs for `work` units of CT
+    long long timeFor(long long work) const
+    {
+        std::int32_t s = getSpeed();
+        return (s == SPEED_ONE) ? work : ((work << SPEED_SHIFT) + s - 1) / s;
+    }
+
+    // time (not work) until RDY + RUN are done on this CPU, wakeup included
     long long expectedFinishTime() const;
 
-    // stats
-    void addBusy() { ++busyTime; }
-    void addIdle() { ++idleTime; }
-    long long getBusy() const { return busyTime; }
-    long long getIdle() const { return idleTime; }
-
-    // RR controls
-    void setTimeSlice(int ts) { timeSlice = ts; }
-    int getTimeSlice() const { return timeSlice; }
-    void resetQuantum() { quantumCounter = 0; }
-    void incQuantum() { ++quantumCounter; }
-    bool quantumExpired() const { return (timeSlice > 0 && quantumCounter >= timeSlice); }
-
-    virtual void enqueue(Process *p) = 0;
-    virtual Process *popReady() = 0;
-    virtual std::size_t readyCount() const = 0;
-    virtual void printReady(std::ostream &os) const = 0;
-    virtual Process *peekReady() const = 0;
+    void setPowerModel(int threshold, int latency)
+    {
+        idleThreshold = threshold;
+        wakeLatency = latency;
+    }
+    bool isAsleep() const;
+    bool isWaking() const { return wakeStart >= 0 && tracker->now < wakeStart + wakeLatency; }
+    void beginWake();
+    // wakeLatency if a wakeup completes right now (the next dispatch waited for it), else 0
+    long long wakeDelay() const
+    {
+        return (wakeStart >= 0 && tracker->now == wakeStart + wakeLatency) ? wakeLatency : 0;
+    }
+    // ticks before this CPU could start running anything
+    long long pendingWake() const;
+
+    // stats (include the still-open busy/idle interval)
+    long long getBusy() const;
+    long long getIdle() const;
+    long long getSleep() const;  // part of idle spent asleep
+    long long getWaking() const; // part of idle spent waking up
+    long long getWakeups() const { return wakeups; }
+
+    // RR controls (0 slice = no quantum); the counter advances in tickKernel
+    void setTimeSlice(int ts) { tracker->lanes.slice[id] = ts; }
+    int getTimeSlice() const { return tracker->lanes.slice[id]; }
+    int getQuantumCounter() const { return tracker->lanes.quantum[id]; }
+    void resetQuantum() { tracker->lanes.quantum[id] = 0; }
+
+protected:
+    // bookkeeping every concrete RDY structure calls on insert/remove
+    void onEnqueued(Process *p);
+    void onDequeued(Process *p);
+    void refreshIdleWithWork();
+
+public:
+    // Every concrete processor provides (non-virtual):
+    //   void enqueue(Process *p);
+    //   Process *popReady();
+    //   Process *peekReady() const;
+    //   std::size_t readyCount() const;
+    //   void forEachReady(F &&f) const; // f(p, MLFQ level or -1)
+    //   bool removeReady(Process *p); // arbitrary RDY entry, O(n) or better
+    //   void copyFrom(const Self &o, F &&map); // o's state, o's processes sent through map
 };
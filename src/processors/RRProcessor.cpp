@@ -4,7 +4,7 @@
 void RRProcessor::enqueue(Process *p)
 {
     rdy.enqueue(p);
-    readyWork += p->getRemaining();
+    onEnqueued(p);
 }
 
 Process *RRProcessor::popReady()
@@ -12,7 +12,7 @@ Process *RRProcessor::popReady()
     Process *p = nullptr;
     if (!rdy.dequeue(p))
         return nullptr;
-    readyWork -= p->getRemaining();
+    onDequeued(p);
     return p;
 }
 
@@ -22,14 +22,10 @@ Process *RRProcessor::peekReady() const
     return node ? node->data : nullptr;
 }
 
-void RRProcessor::printReady(std::ostream &os) const
+bool RRProcessor::removeReady(Process *p)
 {
-    Node<Process *> *cur = rdy.getHead();
-    while (cur)
-    {
-        os << cur->data->getPID();
-        if (cur->next)
-            os << ",";
-        cur = cur->next;
-    }
+    if (!rdy.remove(p))
+        return false;
+    onDequeued(p);
+    return true;
 }
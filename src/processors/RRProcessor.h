@@ -1,21 +1,35 @@
 #pragma once
 #include "processors/Processor.h"
 #include "ds/Queue.h"
-#include <ostream>
 
 class Process;
 
-class RRProcessor : public Processor
+class RRProcessor final : public Processor
 {
 private:
     Queue<Process *> rdy;
 
 public:
-    RRProcessor(int id) : Processor(id, ProcType::RR) {}
+    static constexpr ProcType kType = ProcType::RR;
 
-    void enqueue(Process *p) override;
-    Process *popReady() override;
-    Process *peekReady() const override; 
-    std::size_t readyCount() const override { return rdy.size(); }
-    void printReady(std::ostream &os) const override;
+    RRProcessor(int id) : Processor(id, kType) {}
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return rdy.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        for (Node<Process *> *cur = rdy.getHead(); cur; cur = cur->next)
+            f(cur->data, -1);
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const RRProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        rdy.copyFrom(o.rdy, map);
+    }
 };
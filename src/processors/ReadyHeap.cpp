@@ -0,0 +1,50 @@
+#include "processors/ReadyHeap.h"
+#include "model/Process.h"
+#include <climits>
+
+static constexpr long long RADIX_KEY_LIMIT = 0xFFFFFFFFLL; // LLONG_MAX packs as this
+
+std::uint64_t ReadyHeap::radixKey(const Process *p) const
+{
+    long long k = keyOf(p);
+    std::uint64_t hi = (k == LLONG_MAX) ? (std::uint64_t)RADIX_KEY_LIMIT : (std::uint64_t)k;
+    return (hi << 32) | (std::uint32_t)p->getPID();
+}
+
+void ReadyHeap::toBinaryHeap()
+{
+    while (!radix.empty())
+        heap.push(radix.pop());
+    kind = ReadyQueueKind::BinaryHeap;
+}
+
+void ReadyHeap::push(Process *p)
+{
+    if (kind == ReadyQueueKind::Radix)
+    {
+        long long k = keyOf(p);
+        if (k >= RADIX_KEY_LIMIT && k != LLONG_MAX)
+            toBinaryHeap();
+    }
+    if (kind == ReadyQueueKind::Radix)
+        radix.push(radixKey(p), p);
+    else
+        heap.push(p);
+}
+
+Process *ReadyHeap::pop()
+{
+    if (empty())
+        return nullptr;
+    return kind == ReadyQueueKind::Radix ? radix.pop() : heap.pop();
+}
+
+Process *ReadyHeap::peek() const
+{
+    return kind == ReadyQueueKind::Radix ? radix.peek() : heap.peek();
+}
+
+bool ReadyHeap::remove(Process *p)
+{
+    return kind == ReadyQueueKind::Radix ? radix.remove(radixKey(p), p) : heap.remove(p);
+}
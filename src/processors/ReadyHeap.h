@@ -0,0 +1,68 @@
+#pragma once
+#include "ds/MinHeap.h"
+#include "ds/RadixHeap.h"
+#include <cstddef>
+
+class Process;
+
+enum class ReadyQueueKind
+{
+    BinaryHeap,
+    Radix
+};
+
+// RDY container of the key-ordered processors (SJF by remaining, EDF by
+// deadline): smallest non-negative key first, ties by PID, LLONG_MAX last.
+// Backed by the comparison MinHeap or by a RadixHeap on the packed
+// (key, PID) value; both pop in exactly the same order. The packing holds
+// keys below 2^32 - 1, so a radix queue that gets a larger key (a deadline
+// that late) moves to the MinHeap for good.
+class ReadyHeap
+{
+public:
+    using KeyFunc = long long (*)(const Process *);
+
+private:
+    ReadyQueueKind kind;
+    KeyFunc keyOf;
+    MinHeap<Process *> heap;
+    RadixHeap<Process *> radix;
+
+    std::uint64_t radixKey(const Process *p) const;
+    void toBinaryHeap();
+
+public:
+    // less must order like (keyOf, PID)
+    ReadyHeap(ReadyQueueKind k, KeyFunc key, MinHeap<Process *>::LessFunc less)
+        : kind(k), keyOf(key), heap(less) {}
+
+    bool empty() const { return size() == 0; }
+    std::size_t size() const { return kind == ReadyQueueKind::Radix ? radix.size() : heap.size(); }
+
+    void push(Process *p);
+    Process *pop();
+    Process *peek() const;
+    bool remove(Process *p);
+
+    // o's contents with map applied (same key functions)
+    template <typename F>
+    void copyFrom(const ReadyHeap &o, F &&map)
+    {
+        kind = o.kind;
+        heap.copyFrom(o.heap, map);
+        radix.copyFrom(o.radix, map);
+    }
+
+    // unordered visit, for printing
+    template <typename F>
+    void forEach(F &&f) const
+    {
+        if (kind == ReadyQueueKind::Radix)
+        {
+            radix.forEach(f);
+            return;
+        }
+        for (std::size_t i = 0; i < heap.rawSize(); ++i)
+            f(heap.raw()[i]);
+    }
+};
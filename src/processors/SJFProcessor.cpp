@@ -1,6 +1,11 @@
 #include "processors/SJFProcessor.h"
 #include "model/Process.h"
 
+long long SJFProcessor::keyRemaining(const Process *p)
+{
+    return p->getRemaining();
+}
+
 bool SJFProcessor::lessProc(Process *const &a, Process *const &b)
 {
     if (a->getRemaining() != b->getRemaining())
@@ -10,32 +15,27 @@ bool SJFProcessor::lessProc(Process *const &a, Process *const &b)
 
 void SJFProcessor::enqueue(Process *p)
 {
-    heap.push(p);
-    readyWork += p->getRemaining();
+    rdy.push(p);
+    onEnqueued(p);
 }
 
 Process *SJFProcessor::popReady()
 {
-    if (heap.empty())
-        return nullptr;
-    Process *p = heap.pop();
-    readyWork -= p->getRemaining();
+    Process *p = rdy.pop();
+    if (p)
+        onDequeued(p);
     return p;
 }
 
 Process *SJFProcessor::peekReady() const
 {
-    return heap.peek();
+    return rdy.peek();
 }
 
-void SJFProcessor::printReady(std::ostream &os) const
+bool SJFProcessor::removeReady(Process *p)
 {
-    Process *const *raw = heap.raw();
-    std::size_t n = heap.rawSize();
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        os << raw[i]->getPID();
-        if (i + 1 < n)
-            os << ",";
-    }
+    if (!rdy.remove(p))
+        return false;
+    onDequeued(p);
+    return true;
 }
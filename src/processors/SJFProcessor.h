@@ -1,22 +1,38 @@
 #pragma once
 #include "processors/Processor.h"
-#include "ds/MinHeap.h"
-#include <ostream>
+#include "processors/ReadyHeap.h"
 
 class Process;
 
-class SJFProcessor : public Processor
+class SJFProcessor final : public Processor
 {
 private:
+    static long long keyRemaining(const Process *p); // remaining CT
     static bool lessProc(Process *const &a, Process *const &b);
-    MinHeap<Process *> heap;
+    ReadyHeap rdy;
 
 public:
-    SJFProcessor(int id) : Processor(id, ProcType::SJF), heap(&SJFProcessor::lessProc) {}
+    static constexpr ProcType kType = ProcType::SJF;
 
-    void enqueue(Process *p) override;
-    Process *popReady() override;
-    Process *peekReady() const override;
-    std::size_t readyCount() const override { return heap.size(); }
-    void printReady(std::ostream &os) const override;
+    SJFProcessor(int id, ReadyQueueKind kind = ReadyQueueKind::Radix)
+        : Processor(id, kType), rdy(kind, &SJFProcessor::keyRemaining, &SJFProcessor::lessProc) {}
+
+    void enqueue(Process *p);
+    Process *popReady();
+    Process *peekReady() const;
+    std::size_t readyCount() const { return rdy.size(); }
+    template <typename F>
+    void forEachReady(F &&f) const
+    {
+        rdy.forEach([&](Process *p)
+                    { f(p, -1); });
+    }
+    bool removeReady(Process *p);
+
+    template <typename F>
+    void copyFrom(const SJFProcessor &o, F &&map)
+    {
+        copyStateFrom(o, map(o.running));
+        rdy.copyFrom(o.rdy, map);
+    }
 };
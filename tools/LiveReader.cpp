@@ -0,0 +1,119 @@
+// Prints the live stats block a running `ProcessScheduler --live=N` keeps
+// in a memory-mapped file (see core/LiveStats.h), once or every MS ms
+// until the simulation stops updating it.
+//
+// Usage: ps_live [file=data/live.stats] [--watch=MS]
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "core/LiveStats.h"
+#include "processors/Processor.h"
+
+// consistent copy of the block and the processor rows (seqlock read side)
+static void readStable(const LiveBlock *b, LiveBlock &hdr, std::vector<LiveCpu> &cpus)
+{
+    const LiveCpu *src = reinterpret_cast<const LiveCpu *>(b + 1);
+    while (true)
+    {
+        std::uint32_t s1 = b->seq.load(std::memory_order_acquire);
+        if (s1 & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::memcpy(&hdr.t, &b->t, sizeof(LiveBlock) - offsetof(LiveBlock, t));
+        std::memcpy(cpus.data(), src, sizeof(LiveCpu) * cpus.size());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (b->seq.load(std::memory_order_relaxed) == s1)
+            return;
+    }
+}
+
+static void print(const LiveBlock &h, const std::vector<LiveCpu> &cpus)
+{
+    std::printf("t=%lld  %.0f ticks/s  terminated %lld/%lld\n",
+                (long long)h.t, h.ticksPerSec, (long long)h.terminated, (long long)h.total);
+    std::printf("migrations RTF=%lld MaxW=%lld  steals=%lld  forks=%lld  kills=%lld  aborted=%lld\n",
+                (long long)h.migRTF, (long long)h.migMaxW, (long long)h.steals,
+                (long long)h.forks, (long long)h.kills, (long long)h.aborted);
+    for (std::size_t i = 0; i < cpus.size(); ++i)
+    {
+        const LiveCpu &c = cpus[i];
+        long long total = c.busy + c.idle;
+        std::printf("P%zu [%s] RDY=%lld RUN=", i, procTypeName((ProcType)c.type), (long long)c.ready);
+        if (c.runPid >= 0)
+            std::printf("%d", c.runPid);
+        else
+            std::printf("IDLE");
+        std::printf(" busy=%lld idle=%lld util%%=%.1f\n", (long long)c.busy, (long long)c.idle,
+                    total > 0 ? 100.0 * c.busy / total : 0.0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string path = "data/live.stats";
+    int watchMs = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--watch=", 8) == 0)
+            watchMs = std::atoi(argv[i] + 8);
+        else
+            path = argv[i];
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || (std::size_t)st.st_size < sizeof(LiveBlock))
+    {
+        std::fprintf(stderr, "cannot read %s\n", path.c_str());
+        return 1;
+    }
+    void *map = mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        std::fprintf(stderr, "cannot map %s\n", path.c_str());
+        return 1;
+    }
+
+    const LiveBlock *b = static_cast<const LiveBlock *>(map);
+    if (std::memcmp(b->magic, "PSLIVE1", 8) != 0 || b->version != LIVE_VERSION ||
+        (std::size_t)st.st_size < sizeof(LiveBlock) + sizeof(LiveCpu) * b->procs)
+    {
+        std::fprintf(stderr, "%s: not a live stats file (version %u expected)\n", path.c_str(), LIVE_VERSION);
+        return 1;
+    }
+
+    LiveBlock hdr;
+    std::vector<LiveCpu> cpus(b->procs);
+    std::int64_t lastUpdates = -1;
+    while (true)
+    {
+        readStable(b, hdr, cpus);
+        if (hdr.updates != lastUpdates)
+        {
+            if (lastUpdates >= 0)
+                std::printf("\n");
+            print(hdr, cpus);
+            lastUpdates = hdr.updates;
+        }
+        else if (watchMs > 0 && hdr.terminated >= hdr.total && hdr.total > 0)
+            break; // finished and nothing new
+        if (watchMs <= 0)
+            break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(watchMs));
+    }
+
+    munmap(map, (std::size_t)st.st_size);
+    return 0;
+}